@@ -0,0 +1,55 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+ * Each guest-side benchmark repeats one system call pattern and prints a
+ * single JSON object on standard output:
+ *
+ * 	{"benchmark": "null-syscall", "iterations": 1000000, "elapsed_ns": 81234567}
+ *
+ * The host-side driver, guestrace-bench, runs the benchmarks with and
+ * without guestrace and computes the overhead from these objects.
+ */
+
+static inline unsigned long long
+bench_now(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (unsigned long long) now.tv_sec * 1000000000ull + now.tv_nsec;
+}
+
+/* Return the iteration count in argv[1], or fallback if absent. */
+static inline unsigned long
+bench_iterations(int argc, char *argv[], unsigned long fallback)
+{
+	unsigned long iterations = fallback;
+
+	if (argc > 1) {
+		iterations = strtoul(argv[1], NULL, 0);
+	}
+
+	if (0 == iterations) {
+		fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+		exit(EXIT_FAILURE);
+	}
+
+	return iterations;
+}
+
+static inline void
+bench_report(const char *name, unsigned long iterations, unsigned long long elapsed)
+{
+	printf("{\"benchmark\": \"%s\", \"iterations\": %lu, \"elapsed_ns\": %llu}\n",
+	       name,
+	       iterations,
+	       elapsed);
+}
+
+#endif
@@ -0,0 +1,44 @@
+#include <stdio.h>
+#include <unistd.h>
+
+#include "bench.h"
+
+/*
+ * Measure execve, which replaces the address space and so makes guestrace
+ * flush its process caches. Rather than fork, the program executes itself,
+ * passing the remaining count and the start time along:
+ *
+ * 	execve-storm [iterations [remaining start]]
+ */
+int
+main(int argc, char *argv[])
+{
+	unsigned long iterations = bench_iterations(argc, argv, 2000);
+	unsigned long remaining = iterations;
+	unsigned long long start;
+	char iterations_arg[32], remaining_arg[32], start_arg[32];
+
+	if (argc > 3) {
+		remaining = strtoul(argv[2], NULL, 0);
+		start     = strtoull(argv[3], NULL, 0);
+	} else {
+		start     = bench_now();
+	}
+
+	if (0 == remaining) {
+		bench_report("execve-storm", iterations, bench_now() - start);
+		return EXIT_SUCCESS;
+	}
+
+	snprintf(iterations_arg, sizeof iterations_arg, "%lu", iterations);
+	snprintf(remaining_arg, sizeof remaining_arg, "%lu", remaining - 1);
+	snprintf(start_arg, sizeof start_arg, "%llu", start);
+
+	char *args[] = { argv[0], iterations_arg, remaining_arg, start_arg, NULL };
+
+	execv("/proc/self/exe", args);
+
+	perror("execv");
+
+	return EXIT_FAILURE;
+}
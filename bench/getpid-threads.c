@@ -0,0 +1,61 @@
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "bench.h"
+
+static unsigned long iterations;
+
+static void *
+worker(void *data)
+{
+	for (unsigned long i = 0; i < iterations; i++) {
+		syscall(SYS_getpid);
+	}
+
+	return NULL;
+}
+
+/*
+ * Measure system calls made at once on every online CPU, which exercises
+ * guestrace's handling of concurrent in-flight calls: its trampolines and
+ * syscall-state table. Each thread makes iterations calls.
+ */
+int
+main(int argc, char *argv[])
+{
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	pthread_t *threads;
+	unsigned long long start;
+
+	iterations = bench_iterations(argc, argv, 1000000);
+
+	if (cpus < 1) {
+		cpus = 1;
+	}
+
+	threads = calloc(cpus, sizeof *threads);
+	if (NULL == threads) {
+		perror("calloc");
+		return EXIT_FAILURE;
+	}
+
+	start = bench_now();
+
+	for (long i = 0; i < cpus; i++) {
+		if (0 != pthread_create(&threads[i], NULL, worker, NULL)) {
+			fprintf(stderr, "failed to create thread\n");
+			return EXIT_FAILURE;
+		}
+	}
+
+	for (long i = 0; i < cpus; i++) {
+		pthread_join(threads[i], NULL);
+	}
+
+	bench_report("getpid-threads", iterations * cpus, bench_now() - start);
+
+	free(threads);
+
+	return EXIT_SUCCESS;
+}
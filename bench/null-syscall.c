@@ -0,0 +1,24 @@
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "bench.h"
+
+/*
+ * Measure the cost of a system call which does no work. Getppid bypasses
+ * glibc's caches and takes no locks in the kernel, so nearly all of its
+ * time goes to the kernel entry and exit which guestrace instruments.
+ */
+int
+main(int argc, char *argv[])
+{
+	unsigned long iterations = bench_iterations(argc, argv, 1000000);
+	unsigned long long start = bench_now();
+
+	for (unsigned long i = 0; i < iterations; i++) {
+		syscall(SYS_getppid);
+	}
+
+	bench_report("null-syscall", iterations, bench_now() - start);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,30 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "bench.h"
+
+/*
+ * Measure an open and close of the same file, each iteration being two
+ * system calls, one of which has a string argument which guestrace reads
+ * from guest memory when it prints.
+ */
+int
+main(int argc, char *argv[])
+{
+	unsigned long iterations = bench_iterations(argc, argv, 200000);
+	unsigned long long start = bench_now();
+
+	for (unsigned long i = 0; i < iterations; i++) {
+		int fd = open("/dev/null", O_RDONLY);
+		if (-1 == fd) {
+			perror("open");
+			return EXIT_FAILURE;
+		}
+
+		close(fd);
+	}
+
+	bench_report("open-close", iterations, bench_now() - start);
+
+	return EXIT_SUCCESS;
+}
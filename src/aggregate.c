@@ -0,0 +1,433 @@
+#include <glib.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "aggregate.h"
+#include "stats.h"
+
+/*
+ * How long a call may stay in flight before gt_aggregate_flush() gives up on
+ * its return, as it would on that of a thread killed in a blocking call.
+ * A call which returns later goes uncounted.
+ */
+#define GT_AGGREGATE_CALL_MAX_NS (G_GUINT64_CONSTANT(300) * 1000000000)
+
+/*
+ * System calls from which the calling thread never returns. An aggregate
+ * counts their calls without timing them, so that no call stays in flight.
+ * NtTerminateProcess and NtTerminateThread return if they end another
+ * process or thread, but those calls go untimed too.
+ */
+static const char * const aggregate_noreturn[] = {
+	"sys_exit",
+	"sys_exit_group",
+	"NtTerminateProcess",
+	"NtTerminateThread",
+	NULL
+};
+
+/*
+ * The counters of one system call made by one process. The key of each is
+ * the PID in its upper 32 bits and the index of the system call in the
+ * guest's registry in its lower 32 bits.
+ */
+typedef struct gt_aggregate_entry {
+	gt_pid_t  pid;
+	guint     syscall;
+	char     *process;
+	guint64   calls;
+	guint64   returns;
+	guint64   total_ns;  /* Sum of the time from each call to its return. */
+	guint64   max_ns;
+	guint     in_flight; /* Calls whose gt_aggregate_call refers here. */
+} gt_aggregate_entry;
+
+/*
+ * Passed from aggregate_syscall() to aggregate_sysret() through the loop's
+ * state of the call in flight. Returned to free_calls, rather than to the
+ * allocator, so that an event allocates nothing once the list has grown.
+ * Until then, link holds the call in the aggregate's in_flight queue, or in
+ * its abandoned queue once gt_aggregate_flush() has given up on its return
+ * and set entry to NULL.
+ */
+typedef struct gt_aggregate_call {
+	struct gt_aggregate_call *next;
+	GList                     link;
+	struct gt_aggregate      *aggregate;
+	gt_aggregate_entry       *entry;
+	guint64                   start;
+} gt_aggregate_call;
+
+/* Passed as user_data to the callbacks of one system call. */
+typedef struct gt_aggregate_hook {
+	gt_aggregate *aggregate;
+	guint         syscall;
+	const char   *name;
+} gt_aggregate_hook;
+
+struct gt_aggregate {
+	/* Held by the servicing thread for each event, and by flushes. */
+	GMutex             lock;
+	FILE              *out;
+	char              *guest;  /* Named in each table if not NULL. */
+	gt_aggregate_hook *hooks;  /* One for each system call. */
+	GHashTable        *entries;
+	gt_aggregate_call *free_calls;
+	GQueue             in_flight; /* Oldest call first. */
+	GQueue             abandoned; /* Kept for the loop, which may return them. */
+	gint64             since;  /* Real time of the last flush. */
+};
+
+static guint
+aggregate_key_hash(gconstpointer key)
+{
+	guint64 value = GPOINTER_TO_SIZE(key);
+
+	return (guint) (value ^ (value >> 32)) * 2654435761u;
+}
+
+static gpointer
+aggregate_key(gt_pid_t pid, guint syscall)
+{
+	return GSIZE_TO_POINTER((guint64) pid << 32 | syscall);
+}
+
+static void
+aggregate_entry_free(gpointer data)
+{
+	gt_aggregate_entry *entry = data;
+
+	g_free(entry->process);
+	g_free(entry);
+}
+
+/* Return the counters of syscall in pid, creating them if necessary. */
+static gt_aggregate_entry *
+aggregate_entry(gt_aggregate *aggregate, GtGuestState *state, gt_pid_t pid, guint syscall)
+{
+	gpointer key = aggregate_key(pid, syscall);
+	gt_aggregate_entry *entry;
+
+	entry = g_hash_table_lookup(aggregate->entries, key);
+	if (NULL == entry) {
+		const char *process = gt_guest_get_process_name(state, pid);
+
+		entry          = g_new0(gt_aggregate_entry, 1);
+		entry->pid     = pid;
+		entry->syscall = syscall;
+		entry->process = g_strdup(NULL == process ? "unknown" : process);
+
+		g_hash_table_insert(aggregate->entries, key, entry);
+	}
+
+	return entry;
+}
+
+static void *
+aggregate_syscall(GtGuestState *state, gt_pid_t pid, gt_tid_t tid, void *user_data)
+{
+	gt_aggregate_hook *hook = user_data;
+	gt_aggregate *aggregate = hook->aggregate;
+	gt_aggregate_entry *entry;
+	gt_aggregate_call *call;
+
+	g_mutex_lock(&aggregate->lock);
+
+	entry = aggregate_entry(aggregate, state, pid, hook->syscall);
+	entry->calls++;
+	entry->in_flight++;
+
+	call = aggregate->free_calls;
+	if (NULL != call) {
+		aggregate->free_calls = call->next;
+	} else {
+		call = g_new(gt_aggregate_call, 1);
+	}
+
+	call->link.data = call;
+	call->aggregate = aggregate;
+	call->entry     = entry;
+	call->start     = gt_stats_now();
+
+	g_queue_push_tail_link(&aggregate->in_flight, &call->link);
+
+	g_mutex_unlock(&aggregate->lock);
+
+	return call;
+}
+
+/* The call of a system call whose return guestrace does not trap. */
+static void *
+aggregate_syscall_only(GtGuestState *state, gt_pid_t pid, gt_tid_t tid, void *user_data)
+{
+	gt_aggregate_hook *hook = user_data;
+	gt_aggregate *aggregate = hook->aggregate;
+
+	g_mutex_lock(&aggregate->lock);
+	aggregate_entry(aggregate, state, pid, hook->syscall)->calls++;
+	g_mutex_unlock(&aggregate->lock);
+
+	return NULL;
+}
+
+static void
+aggregate_sysret(GtGuestState *state, gt_pid_t pid, gt_tid_t tid, void *user_data)
+{
+	gt_aggregate_call *call = user_data;
+	gt_aggregate *aggregate = call->aggregate;
+	gt_aggregate_entry *entry;
+	guint64 elapsed = gt_stats_now() - call->start;
+
+	g_mutex_lock(&aggregate->lock);
+
+	/* A flush may have given up on the call meanwhile. */
+	entry = call->entry;
+
+	if (NULL != entry) {
+		g_queue_unlink(&aggregate->in_flight, &call->link);
+
+		entry->returns++;
+		entry->total_ns += elapsed;
+		entry->max_ns    = MAX(entry->max_ns, elapsed);
+		entry->in_flight--;
+	} else {
+		/* gt_aggregate_flush() gave up on the call, and its entry. */
+		g_queue_unlink(&aggregate->abandoned, &call->link);
+	}
+
+	call->next            = aggregate->free_calls;
+	aggregate->free_calls = call;
+
+	g_mutex_unlock(&aggregate->lock);
+}
+
+/*
+ * Create an aggregate which prints its tables to out, naming guest in each if
+ * guest is not NULL. The guest's registry holds syscall_count entries.
+ */
+gt_aggregate *
+gt_aggregate_new(FILE *out, const char *guest, guint syscall_count)
+{
+	gt_aggregate *aggregate = g_new0(gt_aggregate, 1);
+
+	g_mutex_init(&aggregate->lock);
+
+	aggregate->out        = out;
+	aggregate->guest      = g_strdup(guest);
+	aggregate->hooks      = g_new0(gt_aggregate_hook, syscall_count);
+	aggregate->entries    = g_hash_table_new_full(aggregate_key_hash,
+	                                              g_direct_equal,
+	                                              NULL,
+	                                              aggregate_entry_free);
+	aggregate->since      = g_get_real_time();
+
+	g_queue_init(&aggregate->in_flight);
+	g_queue_init(&aggregate->abandoned);
+
+	return aggregate;
+}
+
+/* Return TRUE if the thread which calls name never sees it return. */
+static gboolean
+aggregate_is_noreturn(const char *name)
+{
+	gboolean noreturn = FALSE;
+
+	for (guint i = 0; NULL != aggregate_noreturn[i]; i++) {
+		if (!strcmp(name, aggregate_noreturn[i])) {
+			noreturn = TRUE;
+			break;
+		}
+	}
+
+	return noreturn;
+}
+
+/*
+ * Fill in the callbacks of entry, the index'th in the guest's registry, so
+ * that they count its system call; and, if returns, time each call until it
+ * returns. Like gt_decode_hook_init(), but for an aggregate. Calls which
+ * never return are only counted.
+ */
+void
+gt_aggregate_hook_init(gt_aggregate *aggregate,
+                       guint index,
+                       gboolean returns,
+                       GtCallbackRegistry *entry)
+{
+	gt_aggregate_hook *hook = &aggregate->hooks[index];
+
+	hook->aggregate = aggregate;
+	hook->syscall   = index;
+	hook->name      = entry->name;
+
+	if (aggregate_is_noreturn(entry->name)) {
+		returns = FALSE;
+	}
+
+	entry->syscall_cb = returns ? aggregate_syscall : aggregate_syscall_only;
+	entry->sysret_cb  = returns ? aggregate_sysret : NULL;
+	entry->user_data  = hook;
+}
+
+/* Order entries by PID, then by system call. */
+static gint
+aggregate_entry_compare(gconstpointer a, gconstpointer b)
+{
+	const gt_aggregate_entry *x = *(const gt_aggregate_entry **) a;
+	const gt_aggregate_entry *y = *(const gt_aggregate_entry **) b;
+
+	if (x->pid != y->pid) {
+		return x->pid < y->pid ? -1 : 1;
+	}
+
+	return x->syscall < y->syscall ? -1 : x->syscall > y->syscall;
+}
+
+/*
+ * Give up on the returns of the calls in flight since before cutoff, so that
+ * the entries of the threads killed in them can go. The loop still holds
+ * each call, and may yet return it to aggregate_sysret().
+ */
+static void
+aggregate_abandon_calls(gt_aggregate *aggregate, guint64 cutoff)
+{
+	GList *link;
+
+	while (NULL != (link = g_queue_peek_head_link(&aggregate->in_flight))) {
+		gt_aggregate_call *call = link->data;
+
+		if (call->start >= cutoff) {
+			break;
+		}
+
+		g_queue_unlink(&aggregate->in_flight, link);
+		g_queue_push_tail_link(&aggregate->abandoned, link);
+
+		call->entry->in_flight--;
+		call->entry = NULL;
+	}
+}
+
+/* Free the calls in queue, which the loop will no longer return. */
+static void
+aggregate_free_calls(GQueue *queue)
+{
+	GList *link;
+
+	while (NULL != (link = g_queue_pop_head_link(queue))) {
+		g_free(link->data);
+	}
+}
+
+/*
+ * Print a table of the counters gathered since the last flush, and reset
+ * them. Forget the processes which made no calls in the meantime, so that
+ * the table does not grow with every process the guest ever ran.
+ */
+void
+gt_aggregate_flush(gt_aggregate *aggregate)
+{
+	GPtrArray *rows = g_ptr_array_new();
+	GHashTableIter iter;
+	gpointer data;
+	gint64 now;
+	guint64 monotonic = gt_stats_now();
+
+	g_mutex_lock(&aggregate->lock);
+
+	if (monotonic > GT_AGGREGATE_CALL_MAX_NS) {
+		aggregate_abandon_calls(aggregate, monotonic - GT_AGGREGATE_CALL_MAX_NS);
+	}
+
+	g_hash_table_iter_init(&iter, aggregate->entries);
+	while (g_hash_table_iter_next(&iter, NULL, &data)) {
+		gt_aggregate_entry *entry = data;
+
+		if (0 == entry->calls && 0 == entry->returns) {
+			if (0 == entry->in_flight) {
+				g_hash_table_iter_remove(&iter);
+			}
+			continue;
+		}
+
+		g_ptr_array_add(rows, entry);
+	}
+
+	g_ptr_array_sort(rows, aggregate_entry_compare);
+
+	now = g_get_real_time();
+
+	flockfile(aggregate->out);
+
+	if (NULL != aggregate->guest) {
+		fprintf(aggregate->out, "guest %s: ", aggregate->guest);
+	}
+
+	fprintf(aggregate->out,
+	        "%.1f s\n%-7s %-16s %-24s %10s %10s %10s %10s\n",
+	        (now - aggregate->since) / 1e6,
+	        "PID", "PROCESS", "SYSCALL", "CALLS", "RETURNS", "MEAN US", "MAX US");
+
+	for (guint i = 0; i < rows->len; i++) {
+		gt_aggregate_entry *entry = g_ptr_array_index(rows, i);
+
+		fprintf(aggregate->out,
+		        "%-7u %-16.16s %-24s %10"PRIu64" %10"PRIu64" %10.1f %10.1f\n",
+		        entry->pid,
+		        entry->process,
+		        aggregate->hooks[entry->syscall].name,
+		        entry->calls,
+		        entry->returns,
+		        0 == entry->returns ? 0.0 : entry->total_ns / 1e3 / entry->returns,
+		        entry->max_ns / 1e3);
+
+		entry->calls    = 0;
+		entry->returns  = 0;
+		entry->total_ns = 0;
+		entry->max_ns   = 0;
+	}
+
+	putc('\n', aggregate->out);
+	fflush(aggregate->out);
+
+	funlockfile(aggregate->out);
+
+	aggregate->since = now;
+
+	g_mutex_unlock(&aggregate->lock);
+
+	g_ptr_array_free(rows, TRUE);
+}
+
+/*
+ * Free aggregate. Calls still in flight refer to it, so free it only once the
+ * guest's loop has stopped; then it frees those calls too.
+ */
+void
+gt_aggregate_free(gt_aggregate *aggregate)
+{
+	if (NULL == aggregate) {
+		goto done;
+	}
+
+	while (NULL != aggregate->free_calls) {
+		gt_aggregate_call *call = aggregate->free_calls;
+
+		aggregate->free_calls = call->next;
+		g_free(call);
+	}
+
+	aggregate_free_calls(&aggregate->in_flight);
+	aggregate_free_calls(&aggregate->abandoned);
+
+	g_hash_table_destroy(aggregate->entries);
+	g_free(aggregate->hooks);
+	g_free(aggregate->guest);
+	g_mutex_clear(&aggregate->lock);
+	g_free(aggregate);
+
+done:
+	return;
+}
@@ -0,0 +1,25 @@
+#ifndef AGGREGATE_H
+#define AGGREGATE_H
+
+#include <stdio.h>
+
+#include "guestrace.h"
+
+/*
+ * An aggregate counts the calls and returns of each system call made by
+ * each process, and sums the time between each call and its return, in
+ * place of printing a line per event. gt_aggregate_flush() prints the
+ * counters gathered since the last flush as a table and resets them.
+ */
+
+typedef struct gt_aggregate gt_aggregate;
+
+gt_aggregate *gt_aggregate_new(FILE *out, const char *guest, guint syscall_count);
+void          gt_aggregate_hook_init(gt_aggregate *aggregate,
+                                     guint index,
+                                     gboolean returns,
+                                     GtCallbackRegistry *entry);
+void          gt_aggregate_flush(gt_aggregate *aggregate);
+void          gt_aggregate_free(gt_aggregate *aggregate);
+
+#endif
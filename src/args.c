@@ -0,0 +1,712 @@
+#include <glib.h>
+#include <libvmi/libvmi.h>
+#include <libvmi/events.h>
+#include <string.h>
+
+#include "args.h"
+#include "guestrace-private.h"
+#include "replay.h"
+
+/*
+ * A GtArgs decodes the arguments of the system call which caused an event
+ * only as a callback asks for them. Guest memory reads go through a small
+ * cache of whole pages, and the cache is emptied between events. This way
+ * several reads near one page, such as reads of the stack arguments or of
+ * strings in one user buffer, cost one translation and one mapping.
+ * Emptying the cache costs nothing: each event gets a new epoch, and a page
+ * is valid only if it was read during the current epoch.
+ *
+ * The same cache serves as a per-event TLB for string views: a
+ * GtStringView points straight into a cached page when its string does not
+ * cross a page boundary, and such a page stays put until the next event.
+ * Only strings which cross a page boundary cost a copy.
+ *
+ * A callback which knows what it will read can say so with
+ * gt_args_capture(), which reads only those bytes of each page, in one
+ * read per page, and keeps them beside the page cache for the event.
+ *
+ * Every read which succeeds passes through gt_args_read_dtb() or
+ * gt_args_view_string(). These report the memory to the loop's
+ * GtMemoryFunc, and in a replay loop they read the captured memory instead.
+ */
+
+/* Upper bound on the number of elements of an argv-style array. */
+#define GT_ARGS_MAX_ARGV 4096
+
+/* Upper bound on the pieces of pages which one gt_args_capture() reads. */
+#define GT_ARGS_MAX_SPANS 64
+
+/**
+ * gt_guest_get_args:
+ * @state: a pointer to a #GtGuestState.
+ *
+ * Returns the #GtArgs of the system call which caused the event described by
+ * @state. The #GtArgs remains valid as long as @state does; that is, for the
+ * duration of the callback.
+ */
+GtArgs *
+gt_guest_get_args(GtGuestState *state)
+{
+	GtArgs *args = &state->args;
+
+	if (0 == args->epoch) {
+		args->state = state;
+		args->epoch = ++state->loop->args_epoch;
+	}
+
+	return args;
+}
+
+/* Return the DTB of the address space of the process which caused the event. */
+static addr_t
+gt_args_event_dtb(GtArgs *args)
+{
+	return args->state->event->x86_regs->cr3 & ~GT_CR3_PCID_MASK;
+}
+
+/* Return the DTB of pid's address space, asking libvmi at most once per event. */
+static addr_t
+gt_args_pid_dtb(GtArgs *args, gt_pid_t pid)
+{
+	if (NULL != args->state->loop->replay) {
+		/* A replay holds whatever memory the capture read, from any process. */
+		return gt_args_event_dtb(args);
+	}
+
+	if (0 == args->dtb || pid != args->dtb_pid) {
+		args->dtb     = vmi_pid_to_dtb(args->state->vmi, pid);
+		args->dtb_pid = pid;
+	}
+
+	return args->dtb;
+}
+
+/*
+ * Keep memory, allocated with g_malloc(), until a later event; guestrace
+ * frees it once an event which itself needs scratch memory begins.
+ */
+static void *
+gt_args_scratch_add(GtArgs *args, void *memory)
+{
+	GtLoop *loop = args->state->loop;
+
+	if (NULL == loop->args_scratch) {
+		loop->args_scratch = g_ptr_array_new_with_free_func(g_free);
+	}
+
+	if (args->epoch != loop->args_scratch_epoch) {
+		g_ptr_array_set_size(loop->args_scratch, 0);
+		loop->args_scratch_epoch = args->epoch;
+	}
+
+	g_ptr_array_add(loop->args_scratch, memory);
+
+	return memory;
+}
+
+/* Return the cached copy of the page at va in dtb, reading it if necessary. */
+static gt_args_page *
+gt_args_get_page(GtArgs *args, addr_t dtb, gt_addr_t va)
+{
+	GtLoop *loop = args->state->loop;
+	gt_args_page *page = NULL, *stale = NULL;
+	addr_t pa;
+
+	va &= ~((gt_addr_t) GT_PAGE_SIZE - 1);
+
+	if (NULL == loop->args_pages) {
+		loop->args_pages = g_new0(gt_args_page, GT_ARGS_PAGES);
+	}
+
+	for (int i = 0; i < GT_ARGS_PAGES; i++) {
+		if (args->epoch != loop->args_pages[i].epoch) {
+			stale = NULL == stale ? &loop->args_pages[i] : stale;
+		} else if (va  == loop->args_pages[i].va
+		        && dtb == loop->args_pages[i].dtb) {
+			page = &loop->args_pages[i];
+			goto done;
+		}
+	}
+
+	pa = vmi_pagetable_lookup(args->state->vmi, dtb, va);
+	if (0 == pa) {
+		goto done;
+	}
+
+	/*
+	 * Pages of an earlier event are free; otherwise evict round robin, but
+	 * skip the pages which back views. If every page backs a view, read
+	 * into a page outside the cache.
+	 */
+	if (NULL != stale) {
+		page = stale;
+	} else {
+		for (int i = 0; i < GT_ARGS_PAGES && NULL == page; i++) {
+			gt_args_page *candidate = &loop->args_pages[loop->args_next_page];
+
+			loop->args_next_page = (loop->args_next_page + 1) % GT_ARGS_PAGES;
+
+			if (args->epoch != candidate->pin_epoch) {
+				page = candidate;
+			}
+		}
+
+		if (NULL == page) {
+			page = gt_args_scratch_add(args, g_new0(gt_args_page, 1));
+		}
+	}
+
+	if (GT_PAGE_SIZE != vmi_read_pa(args->state->vmi, pa, page->data, GT_PAGE_SIZE)) {
+		page->epoch = 0;
+		page = NULL;
+		goto done;
+	}
+
+	page->epoch = args->epoch;
+	page->dtb   = dtb;
+	page->va    = va;
+
+done:
+	return page;
+}
+
+/* Return whether the page at va in dtb is in the page cache. */
+static gboolean
+gt_args_page_cached(GtArgs *args, addr_t dtb, gt_addr_t va)
+{
+	GtLoop *loop = args->state->loop;
+
+	if (NULL == loop->args_pages) {
+		return FALSE;
+	}
+
+	for (int i = 0; i < GT_ARGS_PAGES; i++) {
+		if (args->epoch == loop->args_pages[i].epoch
+		 && va  == loop->args_pages[i].va
+		 && dtb == loop->args_pages[i].dtb) {
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+/*
+ * Return the size bytes at va in dtb, which must lie within one page, if
+ * gt_args_capture() read them during this event; otherwise return NULL.
+ */
+static const uint8_t *
+gt_args_find_span(GtArgs *args, addr_t dtb, gt_addr_t va, gsize size)
+{
+	GtLoop *loop = args->state->loop;
+	gt_addr_t page = va & ~((gt_addr_t) GT_PAGE_SIZE - 1);
+	gsize offset = va - page;
+
+	if (args->epoch != loop->args_span_epoch) {
+		return NULL;
+	}
+
+	for (guint i = 0; i < loop->args_spans->len; i++) {
+		const gt_args_span *span = &g_array_index(loop->args_spans, gt_args_span, i);
+
+		if (page == span->va
+		 && dtb  == span->dtb
+		 && offset >= span->offset
+		 && offset + size <= span->offset + span->length) {
+			return loop->args_span_data->data + span->data + (offset - span->offset);
+		}
+	}
+
+	return NULL;
+}
+
+/* Pass memory which a callback read to the loop's GtMemoryFunc, if any. */
+static void
+gt_args_report(GtArgs *args, gt_addr_t vaddr, const void *data, gsize size)
+{
+	GtLoop *loop = args->state->loop;
+
+	if (NULL != loop->memory_cb) {
+		loop->memory_cb(args->state, vaddr, data, size, loop->memory_data);
+	}
+}
+
+/* Copy guest memory through the page cache. */
+static gboolean
+gt_args_copy(GtArgs *args, addr_t dtb, gt_addr_t vaddr, void *buffer, gsize size)
+{
+	gboolean ok = FALSE;
+	uint8_t *out = buffer;
+
+	while (size > 0) {
+		gsize offset = vaddr & (GT_PAGE_SIZE - 1);
+		gsize chunk  = MIN(size, GT_PAGE_SIZE - offset);
+		const uint8_t *captured = gt_args_find_span(args, dtb, vaddr, chunk);
+		const gt_args_page *page;
+
+		if (NULL != captured) {
+			memcpy(out, captured, chunk);
+		} else {
+			page = gt_args_get_page(args, dtb, vaddr);
+			if (NULL == page) {
+				goto done;
+			}
+
+			memcpy(out, page->data + offset, chunk);
+		}
+
+		out   += chunk;
+		vaddr += chunk;
+		size  -= chunk;
+	}
+
+	ok = TRUE;
+
+done:
+	return ok;
+}
+
+/* Like gt_args_read(), but read from the address space dtb. */
+static gboolean
+gt_args_read_dtb(GtArgs *args, addr_t dtb, gt_addr_t vaddr, void *buffer, gsize size)
+{
+	gboolean ok;
+
+	if (NULL != args->state->loop->replay) {
+		return gt_replay_read(args, vaddr, buffer, size);
+	}
+
+	ok = gt_args_copy(args, dtb, vaddr, buffer, size);
+	if (ok) {
+		gt_args_report(args, vaddr, buffer, size);
+	}
+
+	return ok;
+}
+
+/*
+ * Point view at the NUL-terminated string at vaddr in dtb. A string within
+ * one page costs no copy; a longer string is copied into scratch memory.
+ */
+static gboolean
+gt_args_find_string(GtArgs *args, addr_t dtb, gt_addr_t vaddr, GtStringView *view)
+{
+	gboolean ok = FALSE;
+	GString *string = NULL;
+
+	do {
+		gsize offset = vaddr & (GT_PAGE_SIZE - 1);
+		gsize chunk  = GT_PAGE_SIZE - offset;
+		gt_args_page *page = gt_args_get_page(args, dtb, vaddr);
+		const uint8_t *start, *end;
+
+		if (NULL == page) {
+			goto done;
+		}
+
+		start = page->data + offset;
+		end   = memchr(start, '\0', chunk);
+
+		if (NULL == string && NULL != end) {
+			page->pin_epoch = args->epoch;
+			*view = (GtStringView) { (const char *) start, end - start };
+			ok = TRUE;
+			goto done;
+		}
+
+		if (NULL == string) {
+			string = g_string_new(NULL);
+		}
+
+		if (NULL != end) {
+			g_string_append_len(string, (const char *) start, end - start);
+			break;
+		}
+
+		g_string_append_len(string, (const char *) start, chunk);
+		vaddr += chunk;
+	} while (string->len < GT_ARGS_MAX_STRING);
+
+	view->length = string->len;
+	view->data   = gt_args_scratch_add(args, g_string_free(string, FALSE));
+	string       = NULL;
+	ok           = TRUE;
+
+done:
+	if (NULL != string) {
+		g_string_free(string, TRUE);
+	}
+
+	return ok;
+}
+
+/* Like gt_args_find_string(), but report the string, or read it from a replay. */
+static gboolean
+gt_args_view_string(GtArgs *args, addr_t dtb, gt_addr_t vaddr, GtStringView *view)
+{
+	gboolean ok = FALSE;
+
+	if (0 == vaddr || 0 == dtb) {
+		goto done;
+	}
+
+	if (NULL != args->state->loop->replay) {
+		ok = gt_replay_view_string(args, vaddr, view);
+		goto done;
+	}
+
+	ok = gt_args_find_string(args, dtb, vaddr, view);
+	if (ok) {
+		/* Include the terminator, so a replay knows where the string ends. */
+		gt_args_report(args, vaddr, view->data, view->length + 1);
+	}
+
+done:
+	return ok;
+}
+
+/**
+ * gt_args_read:
+ * @args: a #GtArgs.
+ * @vaddr: a virtual address in the address space of the current process.
+ * @buffer: the buffer into which to copy guest memory.
+ * @size: the number of bytes to copy.
+ *
+ * Copies @size bytes of guest memory starting at @vaddr into @buffer. Reads
+ * made through the same @args share a cache of guest pages, so reads close
+ * to one another cost one page-table walk.
+ *
+ * Returns: %TRUE on success; %FALSE if part of the range is not mapped.
+ */
+gboolean
+gt_args_read(GtArgs *args, gt_addr_t vaddr, void *buffer, gsize size)
+{
+	return gt_args_read_dtb(args, gt_args_event_dtb(args), vaddr, buffer, size);
+}
+
+/**
+ * gt_args_capture:
+ * @args: a #GtArgs.
+ * @ranges: the guest memory which the callback intends to read.
+ * @count: the number of elements in @ranges.
+ *
+ * Reads ahead the memory which @ranges describe, so that later calls to
+ * gt_args_read() within them copy from guestrace rather than the guest.
+ * Ranges which share a page cost one translation and one read, which spans
+ * only the bytes the ranges cover rather than the whole page. A callback
+ * which follows pointers through guest structures can thus read each level
+ * of every argument at once: capture the structures, read them, then
+ * capture what they point to. A NULL @vaddr is ignored.
+ */
+void
+gt_args_capture(GtArgs *args, const GtArgsRange *ranges, guint count)
+{
+	GtLoop *loop = args->state->loop;
+	addr_t dtb = gt_args_event_dtb(args);
+	gt_args_span pending[GT_ARGS_MAX_SPANS];
+	guint pending_count = 0;
+
+	/* A replay holds only the memory which the capture read. */
+	if (NULL != loop->replay) {
+		goto done;
+	}
+
+	/* Merge the ranges into one span for each page. */
+	for (guint i = 0; i < count; i++) {
+		gt_addr_t vaddr = ranges[i].vaddr;
+		gsize size = 0 == vaddr ? 0 : MIN(ranges[i].size, GT_ARGS_MAX_STRING);
+
+		while (size > 0) {
+			gt_addr_t page = vaddr & ~((gt_addr_t) GT_PAGE_SIZE - 1);
+			gsize offset   = vaddr - page;
+			gsize chunk    = MIN(size, GT_PAGE_SIZE - offset);
+			guint j = 0;
+
+			while (j < pending_count && page != pending[j].va) {
+				j++;
+			}
+
+			if (j < pending_count) {
+				gsize end = MAX(pending[j].offset + pending[j].length, offset + chunk);
+
+				pending[j].offset = MIN(pending[j].offset, offset);
+				pending[j].length = end - pending[j].offset;
+			} else if (pending_count < GT_ARGS_MAX_SPANS) {
+				/* Beyond that, gt_args_read() falls back to the page cache. */
+				pending[pending_count++] = (gt_args_span) {
+					.dtb    = dtb,
+					.va     = page,
+					.offset = offset,
+					.length = chunk,
+				};
+			}
+
+			vaddr += chunk;
+			size  -= chunk;
+		}
+	}
+
+	if (NULL == loop->args_spans) {
+		loop->args_spans     = g_array_new(FALSE, FALSE, sizeof(gt_args_span));
+		loop->args_span_data = g_byte_array_new();
+	}
+
+	if (args->epoch != loop->args_span_epoch) {
+		g_array_set_size(loop->args_spans, 0);
+		g_byte_array_set_size(loop->args_span_data, 0);
+		loop->args_span_epoch = args->epoch;
+	}
+
+	for (guint i = 0; i < pending_count; i++) {
+		gt_args_span *span = &pending[i];
+		addr_t pa;
+
+		if (gt_args_page_cached(args, dtb, span->va)
+		 || NULL != gt_args_find_span(args, dtb, span->va + span->offset, span->length)) {
+			continue;
+		}
+
+		pa = vmi_pagetable_lookup(args->state->vmi, dtb, span->va);
+		if (0 == pa) {
+			continue;
+		}
+
+		span->data = loop->args_span_data->len;
+		g_byte_array_set_size(loop->args_span_data, span->data + span->length);
+
+		if (span->length != vmi_read_pa(args->state->vmi,
+		                                pa + span->offset,
+		                                loop->args_span_data->data + span->data,
+		                                span->length)) {
+			g_byte_array_set_size(loop->args_span_data, span->data);
+			continue;
+		}
+
+		g_array_append_val(loop->args_spans, *span);
+	}
+
+done:
+	return;
+}
+
+/**
+ * gt_args_get:
+ * @args: a #GtArgs.
+ * @index: the zero-based position of a system-call argument.
+ *
+ * Decodes the @index'th argument of the system call, which might reside in a
+ * register or on the guest's stack depending on the guest's calling
+ * convention. Guestrace decodes each argument at most once per event.
+ *
+ * Returns: the value of the argument, or zero if it cannot be read.
+ */
+gt_reg_t
+gt_args_get(GtArgs *args, guint index)
+{
+	gt_reg_t value = 0;
+
+	if (index >= GT_ARGS_MAX) {
+		goto done;
+	}
+
+	if (!(args->fetched & (1u << index))) {
+		args->values[index] = 0;
+		args->state->loop->os_functions->get_arg(args, index, &args->values[index]);
+		args->fetched |= 1u << index;
+	}
+
+	value = args->values[index];
+
+done:
+	return value;
+}
+
+/**
+ * gt_args_read_string:
+ * @args: a #GtArgs.
+ * @vaddr: a virtual address in the address space of the current process.
+ *
+ * Returns the NUL-terminated string which starts at @vaddr, or NULL on
+ * error. The caller must free the string with g_free().
+ */
+char *
+gt_args_read_string(GtArgs *args, gt_addr_t vaddr)
+{
+	GtStringView view;
+
+	if (!gt_args_view_string(args, gt_args_event_dtb(args), vaddr, &view)) {
+		return NULL;
+	}
+
+	return g_strndup(view.data, view.length);
+}
+
+/**
+ * gt_args_read_unicode_string:
+ * @args: a #GtArgs.
+ * @vaddr: the virtual address of a Windows UNICODE_STRING structure.
+ *
+ * Returns the contents of the UNICODE_STRING at @vaddr converted to UTF-8,
+ * or NULL on error. The caller must free the string with g_free().
+ */
+char *
+gt_args_read_unicode_string(GtArgs *args, gt_addr_t vaddr)
+{
+	char *utf8 = NULL;
+	gunichar2 *utf16 = NULL;
+	gsize length;
+	struct gt_win64_unicode_string header;
+
+	if (0 == vaddr || !gt_args_read(args, vaddr, &header, sizeof header)) {
+		goto done;
+	}
+
+	length = MIN(header.length, GT_ARGS_MAX_STRING) / sizeof *utf16;
+
+	utf16 = g_new(gunichar2, length + 1);
+	if (!gt_args_read(args, header.buffer, utf16, length * sizeof *utf16)) {
+		goto done;
+	}
+
+	utf8 = g_utf16_to_utf8(utf16, length, NULL, NULL, NULL);
+
+done:
+	g_free(utf16);
+
+	return utf8;
+}
+
+/**
+ * gt_args_get_string:
+ * @args: a #GtArgs.
+ * @index: the zero-based position of a system-call argument.
+ *
+ * Like gt_args_read_string(), but reads the string which the @index'th
+ * argument points to.
+ */
+char *
+gt_args_get_string(GtArgs *args, guint index)
+{
+	return gt_args_read_string(args, gt_args_get(args, index));
+}
+
+/**
+ * gt_args_get_unicode_string:
+ * @args: a #GtArgs.
+ * @index: the zero-based position of a system-call argument.
+ *
+ * Like gt_args_read_unicode_string(), but reads the UNICODE_STRING which the
+ * @index'th argument points to.
+ */
+char *
+gt_args_get_unicode_string(GtArgs *args, guint index)
+{
+	return gt_args_read_unicode_string(args, gt_args_get(args, index));
+}
+
+/**
+ * gt_guest_get_string_view:
+ * @state: a pointer to a #GtGuestState.
+ * @vaddr: a virtual address from the guest's address space.
+ * @pid: PID of the virtual address space (0 for kernel).
+ * @view: the #GtStringView to fill in.
+ *
+ * Points @view at the NUL-terminated string which starts at @vaddr. Unlike
+ * gt_guest_get_string(), this usually copies nothing: @view points into
+ * guestrace's per-event copy of the guest page, and it remains valid for the
+ * duration of the callback. Translations, too, are cached per event, so
+ * strings which share a page cost one page-table walk.
+ *
+ * Returns: %TRUE on success; %FALSE if the string is not mapped.
+ */
+gboolean
+gt_guest_get_string_view(GtGuestState *state,
+                         gt_addr_t vaddr,
+                         gt_pid_t pid,
+                         GtStringView *view)
+{
+	GtArgs *args = gt_guest_get_args(state);
+
+	return gt_args_view_string(args, gt_args_pid_dtb(args, pid), vaddr, view);
+}
+
+/**
+ * gt_guest_get_argv_view:
+ * @state: a pointer to a #GtGuestState.
+ * @vaddr: a virtual address from the guest's address space.
+ * @pid: PID of the virtual address space (0 for kernel).
+ * @count: (out) (optional): the number of strings in the array.
+ *
+ * Like gt_guest_get_argv(), but returns an array of #GtStringView which, like
+ * its views, remains valid for the duration of the callback. The caller must
+ * not free it. The array ends with a view whose data is NULL; an element
+ * which cannot be read ends the array early.
+ *
+ * Returns: the array, or NULL on error.
+ */
+const GtStringView *
+gt_guest_get_argv_view(GtGuestState *state,
+                       gt_addr_t vaddr,
+                       gt_pid_t pid,
+                       guint *count)
+{
+	GtArgs *args = gt_guest_get_args(state);
+	addr_t dtb = gt_args_pid_dtb(args, pid);
+	GtStringView *views = NULL;
+	uint64_t element;
+	guint n = 0, i;
+
+	if (0 == vaddr || 0 == dtb) {
+		goto done;
+	}
+
+	/* Count the elements first; the second pass finds their pages cached. */
+	for (n = 0; n < GT_ARGS_MAX_ARGV; n++) {
+		if (!gt_args_read_dtb(args, dtb, vaddr + n * sizeof element, &element, sizeof element)) {
+			goto done;
+		}
+
+		if (0 == element) {
+			break;
+		}
+	}
+
+	views = gt_args_scratch_add(args, g_new(GtStringView, n + 1));
+
+	for (i = 0; i < n; i++) {
+		gt_args_read_dtb(args, dtb, vaddr + i * sizeof element, &element, sizeof element);
+
+		if (!gt_args_view_string(args, dtb, element, &views[i])) {
+			break;
+		}
+	}
+
+	n = i;
+	views[n] = (GtStringView) { NULL, 0 };
+
+done:
+	if (NULL != count) {
+		*count = NULL == views ? 0 : n;
+	}
+
+	return views;
+}
+
+void
+gt_args_free_pages(GtLoop *loop)
+{
+	g_free(loop->args_pages);
+	loop->args_pages = NULL;
+
+	if (NULL != loop->args_scratch) {
+		g_ptr_array_free(loop->args_scratch, TRUE);
+		loop->args_scratch = NULL;
+	}
+
+	if (NULL != loop->args_spans) {
+		g_array_free(loop->args_spans, TRUE);
+		g_byte_array_free(loop->args_span_data, TRUE);
+		loop->args_spans     = NULL;
+		loop->args_span_data = NULL;
+	}
+}
@@ -0,0 +1,23 @@
+#ifndef ARGS_H
+#define ARGS_H
+
+#include "guestrace.h"
+#include "trace-syscalls.h"
+
+/*
+ * Upper bound on the length of the strings which GtArgs decodes, and which
+ * decoder.c reads through it.
+ */
+#define GT_ARGS_MAX_STRING (4 * GT_PAGE_SIZE)
+
+/* Layout of a UNICODE_STRING on 64-bit Windows. */
+struct gt_win64_unicode_string {
+	uint16_t length;         /* Bytes, excluding any terminator. */
+	uint16_t maximum_length;
+	uint32_t padding;
+	uint64_t buffer;
+};
+
+void gt_args_free_pages(GtLoop *loop);
+
+#endif
@@ -0,0 +1,242 @@
+#include <errno.h>
+#include <glib.h>
+#include <libvmi/libvmi.h>
+#include <stdio.h>
+#include <sys/stat.h>
+
+#include "attach-cache.h"
+
+/*
+ * Attaching to a guest discovers facts which depend only on the kernel build:
+ * the return point within the system-call handler and the address of each
+ * kernel symbol. Finding the return point means disassembling the page at
+ * LSTAR, and each symbol costs a libvmi lookup in System.map or the Rekall
+ * profile.
+ *
+ * An attach cache remembers these in a GKeyFile under the directory which
+ * gt_loop_set_attach_cache() names. The file's name is a SHA-256 checksum of
+ * the OS type and the identity (path, size and modification time) of the
+ * System.map or Rekall profile, so each kernel build has its own file. The
+ * contents of the page at LSTAR cannot serve: they hold relocated addresses,
+ * and under KPTI LSTAR points into the separately placed entry trampoline,
+ * so they differ on every randomized boot.
+ *
+ * For the same reason, the cache stores addresses relative not to LSTAR but
+ * to the first of the OS's process-creation functions, which each attach
+ * resolves through libvmi once; see struct os_functions. The entries then
+ * remain valid when KASLR moves the kernel image.
+ */
+
+#define GT_ATTACH_CACHE_LAYOUT  "layout"
+#define GT_ATTACH_CACHE_SYMBOLS "symbols"
+
+struct gt_attach_cache {
+	char     *path;
+	GKeyFile *file;
+	addr_t    base;
+	gboolean  dirty;
+};
+
+/* Add the identity of the symbol file at path to checksum. */
+static void
+gt_attach_cache_add_identity(GChecksum *checksum, const char *path)
+{
+	struct stat info;
+	char *identity;
+
+	if (NULL == path || -1 == stat(path, &info)) {
+		goto done;
+	}
+
+	identity = g_strdup_printf("%s:%ld:%ld",
+	                           path,
+	                           (long) info.st_size,
+	                           (long) info.st_mtime);
+	g_checksum_update(checksum, (const guchar *) identity, -1);
+	g_free(identity);
+
+done:
+	return;
+}
+
+/*
+ * Return the cache of the kernel which loop's guest runs, reading it from
+ * disk the first time. Returns NULL if loop has no cache directory, or if the
+ * kernel has not yet loaded; a later call tries again.
+ */
+static struct gt_attach_cache *
+gt_attach_cache_get(GtLoop *loop)
+{
+	struct gt_attach_cache *cache = NULL;
+	GChecksum *checksum = NULL;
+	addr_t base;
+	char *name;
+
+	if (NULL != loop->attach_cache || NULL == loop->attach_cache_dir) {
+		cache = loop->attach_cache;
+		goto done;
+	}
+
+	/* Zero until the kernel has loaded. */
+	base = vmi_translate_ksym2v(loop->vmi, loop->os_functions->process_create_funcs[0]);
+	if (0 == base) {
+		goto done;
+	}
+
+	checksum = g_checksum_new(G_CHECKSUM_SHA256);
+	g_checksum_update(checksum, (const guchar *) &loop->os, sizeof loop->os);
+	gt_attach_cache_add_identity(checksum, vmi_get_linux_sysmap(loop->vmi));
+	gt_attach_cache_add_identity(checksum, vmi_get_rekall_path(loop->vmi));
+
+	name = g_strdup_printf("%s.attach", g_checksum_get_string(checksum));
+
+	cache        = g_new0(struct gt_attach_cache, 1);
+	cache->path  = g_build_filename(loop->attach_cache_dir, name, NULL);
+	cache->file  = g_key_file_new();
+	cache->base  = base;
+
+	g_free(name);
+
+	/* A missing or unreadable file leaves the cache empty. */
+	g_key_file_load_from_file(cache->file, cache->path, G_KEY_FILE_NONE, NULL);
+
+	loop->attach_cache = cache;
+
+done:
+	if (NULL != checksum) {
+		g_checksum_free(checksum);
+	}
+
+	return cache;
+}
+
+/* Like gt_attach_cache_lookup(), but for a key in group. */
+static gboolean
+gt_attach_cache_lookup_in(GtLoop *loop, const char *group, const char *name, addr_t *va)
+{
+	gboolean found = FALSE;
+	struct gt_attach_cache *cache;
+	char *value = NULL;
+
+	cache = gt_attach_cache_get(loop);
+	if (NULL == cache) {
+		goto done;
+	}
+
+	value = g_key_file_get_value(cache->file, group, name, NULL);
+	if (NULL == value) {
+		goto done;
+	}
+
+	/* An empty value records that the kernel lacks name. */
+	*va   = '\0' == value[0] ? 0 : cache->base + g_ascii_strtoll(value, NULL, 10);
+	found = TRUE;
+
+done:
+	g_free(value);
+
+	return found;
+}
+
+/* Like gt_attach_cache_insert(), but for a key in group. */
+static void
+gt_attach_cache_insert_in(GtLoop *loop, const char *group, const char *name, addr_t va)
+{
+	struct gt_attach_cache *cache;
+
+	cache = gt_attach_cache_get(loop);
+	if (NULL == cache) {
+		goto done;
+	}
+
+	if (0 == va) {
+		g_key_file_set_value(cache->file, group, name, "");
+	} else {
+		g_key_file_set_int64(cache->file, group, name, (gint64) (va - cache->base));
+	}
+
+	cache->dirty = TRUE;
+
+done:
+	return;
+}
+
+/*
+ * Return the address of the kernel symbol, or zero if the kernel lacks it,
+ * as vmi_translate_ksym2v() would. Consults and updates loop's attach cache,
+ * if it has one.
+ */
+addr_t
+gt_attach_cache_ksym2v(GtLoop *loop, const char *symbol)
+{
+	addr_t va;
+
+	if (!gt_attach_cache_lookup_in(loop, GT_ATTACH_CACHE_SYMBOLS, symbol, &va)) {
+		va = vmi_translate_ksym2v(loop->vmi, symbol);
+		gt_attach_cache_insert_in(loop, GT_ATTACH_CACHE_SYMBOLS, symbol, va);
+	}
+
+	return va;
+}
+
+/*
+ * Set va to the address which gt_attach_cache_insert() recorded for name.
+ * Returns FALSE if the cache has no such address, or if loop has no cache.
+ */
+gboolean
+gt_attach_cache_lookup(GtLoop *loop, const char *name, addr_t *va)
+{
+	return gt_attach_cache_lookup_in(loop, GT_ATTACH_CACHE_LAYOUT, name, va);
+}
+
+/* Record va, which discovery found, under name. */
+void
+gt_attach_cache_insert(GtLoop *loop, const char *name, addr_t va)
+{
+	gt_attach_cache_insert_in(loop, GT_ATTACH_CACHE_LAYOUT, name, va);
+}
+
+/* Write loop's attach cache to disk if discovery has added to it. */
+void
+gt_attach_cache_save(GtLoop *loop)
+{
+	struct gt_attach_cache *cache = loop->attach_cache;
+	GError *error = NULL;
+
+	if (NULL == cache || !cache->dirty) {
+		goto done;
+	}
+
+	if (-1 == g_mkdir_with_parents(loop->attach_cache_dir, 0700)
+	 || !g_key_file_save_to_file(cache->file, cache->path, &error)) {
+		fprintf(stderr, "could not write attach cache %s: %s\n",
+		                 cache->path,
+		                 NULL == error ? g_strerror(errno) : error->message);
+		goto done;
+	}
+
+	cache->dirty = FALSE;
+
+done:
+	g_clear_error(&error);
+}
+
+/* Forget loop's attach cache, without writing it. */
+void
+gt_attach_cache_free(GtLoop *loop)
+{
+	struct gt_attach_cache *cache = loop->attach_cache;
+
+	if (NULL == cache) {
+		goto done;
+	}
+
+	g_key_file_free(cache->file);
+	g_free(cache->path);
+	g_free(cache);
+
+	loop->attach_cache = NULL;
+
+done:
+	return;
+}
@@ -0,0 +1,13 @@
+#ifndef ATTACH_CACHE_H
+#define ATTACH_CACHE_H
+
+#include "guestrace.h"
+#include "guestrace-private.h"
+
+addr_t gt_attach_cache_ksym2v(GtLoop *loop, const char *symbol);
+gboolean gt_attach_cache_lookup(GtLoop *loop, const char *name, addr_t *va);
+void gt_attach_cache_insert(GtLoop *loop, const char *name, addr_t va);
+void gt_attach_cache_save(GtLoop *loop);
+void gt_attach_cache_free(GtLoop *loop);
+
+#endif
@@ -0,0 +1,657 @@
+/*
+ * Microbenchmarks of the work guestrace does for each event, which "make
+ * check" runs against the mock guest of mock-libvmi.c, so that they need no
+ * Xen host. Each prints one JSON object on standard output:
+ *
+ * 	{"benchmark": "bp-lookup", "iterations": 1000000, "ns_per_op": 2.1, "allocations_per_op": 0.00}
+ *
+ * An operation is one lookup, one insertion and removal, or one system
+ * call's call and return, according to the benchmark. The times include
+ * the mock's own cost, such as copying guest memory, which is small next
+ * to that of libvmi. Including trace-syscalls.c exposes the loop's static
+ * internals, such as gt_paddr_record_from_va(), to the benchmarks.
+ */
+
+#include "trace-syscalls.c"
+
+#include <inttypes.h>
+
+#include "decoder.h"
+#include "generated-linux.h"
+#include "generated-windows.h"
+#include "mock-libvmi.h"
+#include "sinks.h"
+
+/* Iterations of each benchmark unless otherwise specified. */
+#define BENCH_DEFAULT_ITERATIONS 100000
+
+/* Breakpoints in each guest; about one for each Linux system call. */
+#define BENCH_BREAKPOINTS 400
+
+/* Threads whose system calls the benchmarks interleave. */
+#define BENCH_THREADS 16
+
+/* Where things live in the mock guest; each translates to a nonzero address. */
+#define BENCH_LSTAR        0xffffffff81201000ull
+#define BENCH_RETURN_ADDR  (BENCH_LSTAR + 0x40)
+#define BENCH_TRAMPOLINES  0x800 /* Offset of the int 3s from BENCH_LSTAR. */
+#define BENCH_FUNCS        0xffffffff81100000ull
+#define BENCH_STACKS       0xffffc90000010000ull
+#define BENCH_TASK         0xffff888000380000ull
+#define BENCH_DATA         0x00007f0000300000ull
+#define BENCH_PID          426
+
+/* Offsets in the mock guest's task, under both Linux and Windows names. */
+#define BENCH_TASK_LIST 0x10
+#define BENCH_TASK_PID  0x20
+#define BENCH_TASK_NAME 0x30
+#define BENCH_TASK_HEAD 0x100 /* PsActiveProcessHead, outside the task. */
+
+typedef struct bench_guest {
+	GtLoop          *loop;
+	GPtrArray       *records;
+	vmi_event_t      event;
+	x86_registers_t  regs;
+} bench_guest;
+
+typedef void (*bench_op)(gpointer context, guint64 i);
+
+static guint64   iterations = BENCH_DEFAULT_ITERATIONS;
+static char    **selected;
+static int       selected_count;
+static FILE     *devnull;
+
+/*
+ * Count the allocations of the process, whether they come through GLib or
+ * straight from the C library, for bench_measure().
+ */
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *memory, size_t size);
+
+static guint64 bench_allocations;
+
+void *
+malloc(size_t size)
+{
+	bench_allocations++;
+	return __libc_malloc(size);
+}
+
+void *
+calloc(size_t count, size_t size)
+{
+	bench_allocations++;
+	return __libc_calloc(count, size);
+}
+
+void *
+realloc(void *memory, size_t size)
+{
+	bench_allocations++;
+	return __libc_realloc(memory, size);
+}
+
+static gboolean
+bench_selected(const char *name)
+{
+	gboolean fnval = 0 == selected_count;
+
+	for (int i = 0; i < selected_count; i++) {
+		if (0 == strcmp(name, selected[i])) {
+			fnval = TRUE;
+			break;
+		}
+	}
+
+	return fnval;
+}
+
+/*
+ * Run op iterations times, after a tenth as many untimed iterations to fill
+ * the caches and grow the tables, and print the mean cost of each.
+ */
+static void
+bench_measure(const char *name, bench_op op, gpointer context)
+{
+	guint64 warmup = iterations / 10 + 1;
+	guint64 start, elapsed, allocations;
+
+	if (!bench_selected(name)) {
+		goto done;
+	}
+
+	for (guint64 i = 0; i < warmup; i++) {
+		op(context, i);
+	}
+
+	allocations = bench_allocations;
+	start       = gt_stats_now();
+
+	for (guint64 i = 0; i < iterations; i++) {
+		op(context, i);
+	}
+
+	elapsed     = gt_stats_now() - start;
+	allocations = bench_allocations - allocations;
+
+	printf("{\"benchmark\": \"%s\", \"iterations\": %"PRIu64", "
+	       "\"ns_per_op\": %.1f, \"allocations_per_op\": %.2f}\n",
+	       name,
+	       iterations,
+	       (double) elapsed / iterations,
+	       (double) allocations / iterations);
+	fflush(stdout);
+
+done:
+	return;
+}
+
+/* Write size bytes of data to the mock guest at va. */
+static void
+bench_poke(bench_guest *guest, addr_t va, const void *data, size_t size)
+{
+	vmi_instance_t vmi = guest->loop->vmi;
+
+	vmi_write_pa(vmi, vmi_translate_kv2p(vmi, va), (void *) data, size);
+}
+
+static void
+bench_poke_64(bench_guest *guest, addr_t va, uint64_t value)
+{
+	bench_poke(guest, va, &value, sizeof value);
+}
+
+static addr_t
+bench_stack(guint64 i)
+{
+	return BENCH_STACKS + (i % BENCH_THREADS) * 0x100;
+}
+
+/*
+ * Create a loop on a mock guest running os, as gt_loop_new() would once it
+ * found the return point and trampolines, but with no breakpoints; and give
+ * the guest a single process, BENCH_PID, named "bench".
+ */
+static bench_guest *
+bench_guest_new(os_t os)
+{
+	bench_guest *guest = g_new0(bench_guest, 1);
+	GtLoop *loop;
+	vmi_instance_t vmi;
+	addr_t list = BENCH_TASK + BENCH_TASK_LIST;
+	uint32_t pid = BENCH_PID;
+
+	loop = guest->loop = _gt_loop_alloc("bench");
+	vmi  = loop->vmi   = mock_vmi_new(os);
+
+	loop->os                = os;
+	loop->os_functions      = VMI_OS_WINDOWS == os ? &os_functions_windows : &os_functions_linux;
+	loop->return_addr_width = vmi_get_address_width(vmi);
+	loop->lstar_addr        = BENCH_LSTAR;
+	loop->return_addr       = BENCH_RETURN_ADDR;
+
+	vmi_set_vcpureg(vmi, BENCH_LSTAR, MSR_LSTAR, 0);
+
+	for (guint i = 0; i <= GT_MAX_TRAMPOLINES; i++) {
+		bench_poke(guest, BENCH_LSTAR + BENCH_TRAMPOLINES + 16 * i, &GT_BREAKPOINT_INST, 1);
+	}
+
+	loop->trampoline_addr = gt_find_trampoline_addr(loop);
+	g_assert(0 != loop->trampoline_addr);
+
+	mock_vmi_set_symbol(vmi, "init_task", BENCH_TASK);
+	mock_vmi_set_symbol(vmi, "PsActiveProcessHead", BENCH_TASK + BENCH_TASK_HEAD);
+	mock_vmi_set_offset(vmi, "linux_tasks", BENCH_TASK_LIST);
+	mock_vmi_set_offset(vmi, "linux_pid",   BENCH_TASK_PID);
+	mock_vmi_set_offset(vmi, "linux_name",  BENCH_TASK_NAME);
+	mock_vmi_set_offset(vmi, "win_tasks",   BENCH_TASK_LIST);
+	mock_vmi_set_offset(vmi, "win_pid",     BENCH_TASK_PID);
+	mock_vmi_set_offset(vmi, "win_pname",   BENCH_TASK_NAME);
+
+	bench_poke_64(guest, list, list);
+	bench_poke_64(guest, BENCH_TASK + BENCH_TASK_HEAD, list);
+	bench_poke(guest, BENCH_TASK + BENCH_TASK_PID, &pid, sizeof pid);
+	bench_poke(guest, BENCH_TASK + BENCH_TASK_NAME, "bench", sizeof "bench");
+
+	guest->records = g_ptr_array_new_with_free_func(gt_free_paddr_record);
+
+	guest->event.data     = loop;
+	guest->event.vcpu_id  = 0;
+	guest->event.x86_regs = &guest->regs;
+	guest->regs.cr3       = (addr_t) BENCH_PID << 12;
+
+	return guest;
+}
+
+/* Add a breakpoint at the next kernel function; see bench_guest_index(). */
+static gt_paddr_record *
+bench_guest_add(bench_guest *guest,
+                const char *name,
+                GtSyscallFunc syscall_cb,
+                GtSysretFunc sysret_cb,
+                void *data)
+{
+	gt_paddr_record *record = g_new0(gt_paddr_record, 1);
+
+	record->va         = BENCH_FUNCS + guest->records->len * 64;
+	record->syscall_cb = syscall_cb;
+	record->sysret_cb  = sysret_cb;
+	record->data       = data;
+	record->enabled    = TRUE;
+	record->name       = g_strdup(name);
+
+	g_rec_mutex_lock(&guest->loop->lock);
+	record->id = _gt_loop_cb_id(guest->loop, name);
+	g_rec_mutex_unlock(&guest->loop->lock);
+
+	g_ptr_array_add(guest->records, record);
+
+	return record;
+}
+
+/* Index the breakpoints, as gt_bp_index_rebuild() would, once all are added. */
+static void
+bench_guest_index(bench_guest *guest)
+{
+	GtLoop *loop = guest->loop;
+	uint8_t bits = GT_BP_INDEX_MIN_BITS;
+
+	while ((1ull << bits) < 2ull * guest->records->len) {
+		bits++;
+	}
+
+	g_free(loop->bp_index);
+	loop->bp_index      = g_new0(gt_bp_slot, 1ull << bits);
+	loop->bp_index_bits = bits;
+
+	for (guint i = 0; i < guest->records->len; i++) {
+		gt_bp_index_insert(loop, g_ptr_array_index(guest->records, i));
+	}
+}
+
+static void
+bench_guest_free(bench_guest *guest)
+{
+	gt_loop_free(guest->loop);
+	g_ptr_array_free(guest->records, TRUE);
+	g_free(guest);
+}
+
+/*
+ * Have the thread whose stack pointer is thread call the function at which
+ * record's breakpoint lies, then return, as the guest would.
+ */
+static void
+bench_guest_syscall(bench_guest *guest, gt_paddr_record *record, addr_t thread)
+{
+	GtLoop *loop = guest->loop;
+	vmi_instance_t vmi = loop->vmi;
+	addr_t return_to = 0;
+
+	bench_poke_64(guest, thread, loop->return_addr);
+
+	guest->regs.rsp                   = thread;
+	guest->event.interrupt_event.gla = record->va;
+	gt_breakpoint_cb(vmi, &guest->event);
+
+	/* The return pops whatever the call left on the stack. */
+	vmi_read_64_va(vmi, thread, 0, &return_to);
+	if (return_to == loop->return_addr) {
+		goto done;
+	}
+
+	guest->regs.rsp                   = thread + loop->return_addr_width;
+	guest->event.interrupt_event.gla = return_to;
+	gt_breakpoint_cb(vmi, &guest->event);
+
+done:
+	return;
+}
+
+static void *
+bench_syscall_cb(GtGuestState *state, gt_pid_t pid, gt_tid_t tid, void *user_data)
+{
+	return user_data;
+}
+
+static void
+bench_sysret_cb(GtGuestState *state, gt_pid_t pid, gt_tid_t tid, void *user_data)
+{
+}
+
+/* Add BENCH_BREAKPOINTS breakpoints with empty callbacks. */
+static void
+bench_guest_add_empty(bench_guest *guest, gboolean returns)
+{
+	for (guint i = 0; i < BENCH_BREAKPOINTS; i++) {
+		char *name = g_strdup_printf("bench_%u", i);
+
+		bench_guest_add(guest, name, bench_syscall_cb, returns ? bench_sysret_cb : NULL, NULL);
+		g_free(name);
+	}
+
+	bench_guest_index(guest);
+}
+
+static void
+bench_lookup_op(gpointer context, guint64 i)
+{
+	bench_guest *guest = context;
+	volatile gt_paddr_record *record;
+
+	record = gt_paddr_record_from_va(guest->loop, BENCH_FUNCS + (i % BENCH_BREAKPOINTS) * 64);
+	g_assert(NULL != record);
+}
+
+static void
+bench_lookup(void)
+{
+	bench_guest *guest = bench_guest_new(VMI_OS_LINUX);
+
+	bench_guest_add_empty(guest, TRUE);
+	bench_measure("bp-lookup", bench_lookup_op, guest);
+	bench_guest_free(guest);
+}
+
+static void
+bench_syscall_state_op(gpointer context, guint64 i)
+{
+	bench_guest *guest = context;
+	addr_t thread = BENCH_STACKS + 0x100000 + (i % 1024) * 0x100;
+
+	gt_syscall_state_insert(guest->loop, thread)->data = guest;
+	gt_syscall_state_remove(guest->loop, thread);
+}
+
+/* Insert and remove states while as many calls as a VCPU expects are in flight. */
+static void
+bench_syscall_state(void)
+{
+	bench_guest *guest = bench_guest_new(VMI_OS_LINUX);
+
+	for (guint i = 0; i < GT_SYSCALL_STATES_PER_VCPU - 1; i++) {
+		gt_syscall_state_insert(guest->loop, bench_stack(i) + i * 0x1000)->data = guest;
+	}
+
+	bench_measure("syscall-state", bench_syscall_state_op, guest);
+	bench_guest_free(guest);
+}
+
+static void
+bench_event_op(gpointer context, guint64 i)
+{
+	bench_guest *guest = context;
+
+	bench_guest_syscall(guest,
+	                    g_ptr_array_index(guest->records, i % BENCH_BREAKPOINTS),
+	                    bench_stack(i));
+}
+
+/*
+ * Service calls and returns with empty callbacks: through a private
+ * trampoline, through the shared trampoline, and in call-only mode.
+ */
+static void
+bench_events(void)
+{
+	bench_guest *guest = bench_guest_new(VMI_OS_LINUX);
+
+	bench_guest_add_empty(guest, TRUE);
+	bench_measure("event-trampoline", bench_event_op, guest);
+
+	gt_free_trampolines(guest->loop);
+	bench_measure("event-shared", bench_event_op, guest);
+	bench_guest_free(guest);
+
+	guest = bench_guest_new(VMI_OS_LINUX);
+	bench_guest_add_empty(guest, FALSE);
+	bench_measure("event-call-only", bench_event_op, guest);
+	bench_guest_free(guest);
+}
+
+typedef enum bench_sink_type {
+	BENCH_SINK_TEXT,
+	BENCH_SINK_JSON,
+	BENCH_SINK_BINARY,
+} bench_sink_type;
+
+static void
+bench_args_sys_read(bench_guest *guest)
+{
+	guest->regs.rdi = 3;
+	guest->regs.rsi = BENCH_DATA;
+	guest->regs.rdx = 4096;
+	guest->regs.rax = 4096;
+}
+
+static void
+bench_args_sys_open(bench_guest *guest)
+{
+	static const char path[] = "/usr/lib/x86_64-linux-gnu/libc.so.6";
+
+	bench_poke(guest, BENCH_DATA, path, sizeof path);
+
+	guest->regs.rdi = BENCH_DATA;
+	guest->regs.rsi = 0x80000; /* O_CLOEXEC */
+	guest->regs.rdx = 0;
+	guest->regs.rax = 3;
+}
+
+/* NtOpenFile(&handle, access, &attributes, &status, share, options). */
+static void
+bench_args_nt_open_file(bench_guest *guest)
+{
+	addr_t handle = BENCH_DATA, attributes = BENCH_DATA + 0x100;
+	addr_t name = BENCH_DATA + 0x200, buffer = BENCH_DATA + 0x300;
+	glong length = 0;
+	gunichar2 *utf16 = g_utf8_to_utf16("\\??\\C:\\Windows\\System32\\ntdll.dll",
+	                                   -1,
+	                                   NULL,
+	                                   &length,
+	                                   NULL);
+	uint16_t bytes = length * sizeof *utf16;
+	uint32_t attributes_length = 48;
+
+	bench_poke(guest, buffer, utf16, bytes);
+	bench_poke(guest, name, &bytes, sizeof bytes);
+	bench_poke(guest, name + 2, &bytes, sizeof bytes);
+	bench_poke_64(guest, name + 8, buffer);
+	bench_poke(guest, attributes, &attributes_length, sizeof attributes_length);
+	bench_poke_64(guest, attributes + 16, name);
+	bench_poke_64(guest, handle, 0x1c4);
+
+	/* The fifth and sixth arguments follow the home area on each stack. */
+	for (guint i = 0; i < BENCH_THREADS; i++) {
+		bench_poke_64(guest, bench_stack(i) + 5 * sizeof(uint64_t), 0x7);
+		bench_poke_64(guest, bench_stack(i) + 6 * sizeof(uint64_t), 0x60);
+	}
+
+	guest->regs.rcx = handle;
+	guest->regs.rdx = 0x100021; /* SYNCHRONIZE | FILE_READ_DATA | FILE_EXECUTE */
+	guest->regs.r8  = attributes;
+	guest->regs.r9  = BENCH_DATA + 0x80;
+	guest->regs.rax = 0;
+
+	g_free(utf16);
+}
+
+/* The system calls which the decoder and each sink format. */
+static const struct {
+	const char *name;
+	os_t        os;
+	const char *syscall;
+	bench_sink_type sink;
+	void      (*args) (bench_guest *guest);
+} BENCH_DECODES[] = {
+	{ "text-sys_read",    VMI_OS_LINUX,   "sys_read",   BENCH_SINK_TEXT,   bench_args_sys_read },
+	{ "text-sys_open",    VMI_OS_LINUX,   "sys_open",   BENCH_SINK_TEXT,   bench_args_sys_open },
+	{ "json-sys_open",    VMI_OS_LINUX,   "sys_open",   BENCH_SINK_JSON,   bench_args_sys_open },
+	{ "binary-sys_open",  VMI_OS_LINUX,   "sys_open",   BENCH_SINK_BINARY, bench_args_sys_open },
+	{ "text-NtOpenFile",  VMI_OS_WINDOWS, "NtOpenFile", BENCH_SINK_TEXT,   bench_args_nt_open_file },
+	{ "json-NtOpenFile",  VMI_OS_WINDOWS, "NtOpenFile", BENCH_SINK_JSON,   bench_args_nt_open_file },
+};
+
+typedef struct bench_decode {
+	bench_guest     *guest;
+	gt_paddr_record *record;
+} bench_decode;
+
+static void
+bench_decode_op(gpointer context, guint64 i)
+{
+	bench_decode *decode = context;
+
+	bench_guest_syscall(decode->guest, decode->record, bench_stack(i));
+}
+
+/*
+ * Service calls and returns which the decoder describes to a sink, as
+ * guestrace does in its default, JSON and binary modes; the sinks write to
+ * /dev/null, or to a ring in a temporary file.
+ */
+static gboolean
+bench_decodes(void)
+{
+	gboolean fnval = FALSE;
+
+	for (guint i = 0; i < G_N_ELEMENTS(BENCH_DECODES); i++) {
+		GtOSType os = VMI_OS_WINDOWS == BENCH_DECODES[i].os ? GT_OS_WINDOWS : GT_OS_LINUX;
+		const gt_syscall_desc *desc = GT_OS_WINDOWS == os ? GT_WINDOWS_SYSCALLS : GT_LINUX_SYSCALLS;
+		GtCallbackRegistry registry[2] = { { 0 } };
+		gt_binary_trace *trace = NULL;
+		char *path = NULL;
+		gt_decode_hook hook;
+		bench_decode decode;
+		gt_sink *sink;
+
+		if (!bench_selected(BENCH_DECODES[i].name)) {
+			continue;
+		}
+
+		while (NULL != desc->name && 0 != strcmp(desc->name, BENCH_DECODES[i].syscall)) {
+			desc++;
+		}
+
+		if (NULL == desc->name) {
+			fprintf(stderr, "no description of %s\n", BENCH_DECODES[i].syscall);
+			goto done;
+		}
+
+		registry[0].name = (char *) desc->name;
+
+		switch (BENCH_DECODES[i].sink) {
+		case BENCH_SINK_TEXT:
+			sink = gt_text_sink_new(os, devnull, NULL);
+			break;
+		case BENCH_SINK_JSON:
+			sink = gt_json_sink_new(devnull, NULL);
+			break;
+		case BENCH_SINK_BINARY:
+		default: {
+			int fd;
+
+			path = g_build_filename(g_get_tmp_dir(), "bench-hot-path-XXXXXX", NULL);
+			fd   = g_mkstemp(path);
+			if (-1 == fd) {
+				perror("failed to create binary trace");
+				g_free(path);
+				goto done;
+			}
+
+			close(fd);
+
+			trace = gt_binary_trace_open(path, 4096, os, registry);
+			if (NULL == trace) {
+				unlink(path);
+				g_free(path);
+				goto done;
+			}
+
+			sink = gt_binary_sink_new(trace, FALSE);
+			break;
+		}
+		}
+
+		gt_decode_hook_init(&hook, sink, desc, 0, TRUE, &registry[0]);
+
+		decode.guest  = bench_guest_new(BENCH_DECODES[i].os);
+		decode.record = bench_guest_add(decode.guest,
+		                                registry[0].name,
+		                                registry[0].syscall_cb,
+		                                registry[0].sysret_cb,
+		                                registry[0].user_data);
+		bench_guest_index(decode.guest);
+		BENCH_DECODES[i].args(decode.guest);
+
+		bench_measure(BENCH_DECODES[i].name, bench_decode_op, &decode);
+
+		bench_guest_free(decode.guest);
+		gt_sink_free(sink);
+
+		if (NULL != trace) {
+			gt_binary_trace_close(trace);
+			unlink(path);
+			g_free(path);
+		}
+	}
+
+	fnval = TRUE;
+
+done:
+	return fnval;
+}
+
+static void
+usage()
+{
+	fprintf(stderr, "usage: bench-hot-path [-n iterations] [benchmark...]\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+	int opt, fnval = EXIT_FAILURE;
+
+	while ((opt = getopt(argc, argv, "hn:")) != -1) {
+		switch (opt) {
+		case 'n':
+			iterations = g_ascii_strtoull(optarg, NULL, 0);
+			if (0 == iterations) {
+				usage();
+				goto done;
+			}
+			break;
+		case 'h':
+		default:
+			usage();
+			goto done;
+		}
+	}
+
+	selected       = argv + optind;
+	selected_count = argc - optind;
+
+	devnull = fopen("/dev/null", "w");
+	if (NULL == devnull) {
+		perror("failed to open /dev/null");
+		goto done;
+	}
+
+	bench_lookup();
+	bench_syscall_state();
+	bench_events();
+
+	if (!bench_decodes()) {
+		goto done;
+	}
+
+	fnval = EXIT_SUCCESS;
+
+done:
+	if (NULL != devnull) {
+		fclose(devnull);
+	}
+
+	return fnval;
+}
@@ -0,0 +1,176 @@
+#include <fcntl.h>
+#include <glib.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "binary-trace.h"
+
+G_STATIC_ASSERT(64 == sizeof(gt_binary_trace_header));
+G_STATIC_ASSERT(88 == sizeof(gt_binary_record));
+
+/* Alignment of the ring within the trace file. */
+#define GT_BINARY_TRACE_ALIGN 4096
+
+struct gt_binary_trace {
+	int                     fd;
+	void                   *map;
+	size_t                  map_size;
+	gt_binary_trace_header *header;
+	gt_binary_record       *records;
+};
+
+/*
+ * Create the trace file at path, size it to hold capacity records, and map it
+ * into memory. The name table records the name of each entry in registry, so
+ * the syscall field of each record is an index into registry.
+ */
+gt_binary_trace *
+gt_binary_trace_open(const char *path,
+                     uint64_t capacity,
+                     GtOSType os,
+                     const GtCallbackRegistry *registry)
+{
+	int rc;
+	gt_binary_trace *trace = NULL;
+	uint32_t name_count = 0;
+	uint64_t names_size = 0, records_offset;
+
+	for (name_count = 0; NULL != registry[name_count].name; name_count++) {
+		names_size += strlen(registry[name_count].name) + 1;
+	}
+
+	if (name_count > G_MAXUINT16 + 1) {
+		fprintf(stderr, "too many system calls for binary trace\n");
+		goto done;
+	}
+
+	records_offset = sizeof(gt_binary_trace_header) + names_size;
+	records_offset = (records_offset + GT_BINARY_TRACE_ALIGN - 1)
+	               & ~((uint64_t) GT_BINARY_TRACE_ALIGN - 1);
+
+	trace = g_new0(gt_binary_trace, 1);
+	trace->map      = MAP_FAILED;
+	trace->map_size = records_offset + capacity * sizeof(gt_binary_record);
+
+	trace->fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (-1 == trace->fd) {
+		perror("failed to open binary trace");
+		goto done;
+	}
+
+	rc = ftruncate(trace->fd, trace->map_size);
+	if (-1 == rc) {
+		perror("failed to size binary trace");
+		goto done;
+	}
+
+	trace->map = mmap(NULL,
+	                  trace->map_size,
+	                  PROT_READ | PROT_WRITE,
+	                  MAP_SHARED,
+	                  trace->fd,
+	                  0);
+	if (MAP_FAILED == trace->map) {
+		perror("failed to map binary trace");
+		goto done;
+	}
+
+	trace->header  = trace->map;
+	trace->records = (gt_binary_record *) ((char *) trace->map + records_offset);
+
+	memcpy(trace->header->magic, GT_BINARY_TRACE_MAGIC, sizeof(trace->header->magic));
+	trace->header->version        = GT_BINARY_TRACE_VERSION;
+	trace->header->record_size    = sizeof(gt_binary_record);
+	trace->header->os             = os;
+	trace->header->name_count     = name_count;
+	trace->header->names_offset   = sizeof(gt_binary_trace_header);
+	trace->header->names_size     = names_size;
+	trace->header->records_offset = records_offset;
+	trace->header->capacity       = capacity;
+	trace->header->head           = 0;
+
+	char *names = (char *) trace->map + trace->header->names_offset;
+	for (uint32_t i = 0; i < name_count; i++) {
+		size_t len = strlen(registry[i].name) + 1;
+		memcpy(names, registry[i].name, len);
+		names += len;
+	}
+
+done:
+	if (NULL != trace && MAP_FAILED == trace->map) {
+		if (-1 != trace->fd) {
+			close(trace->fd);
+		}
+		g_free(trace);
+		trace = NULL;
+	}
+
+	return trace;
+}
+
+/*
+ * Return the slot which will hold the next record. The caller fills in the
+ * slot and then calls gt_binary_trace_commit(); no system call or copy
+ * stands between the two.
+ */
+gt_binary_record *
+gt_binary_trace_reserve(gt_binary_trace *trace)
+{
+	return &trace->records[trace->header->head % trace->header->capacity];
+}
+
+/* Publish the record most recently returned by gt_binary_trace_reserve(). */
+void
+gt_binary_trace_commit(gt_binary_trace *trace)
+{
+	/* Ensure a concurrent reader never observes a partial record. */
+	__atomic_store_n(&trace->header->head,
+	                  trace->header->head + 1,
+	                  __ATOMIC_RELEASE);
+}
+
+/* Record size bytes of guest memory at vaddr, in as many records as it takes. */
+void
+gt_binary_trace_add_memory(gt_binary_trace *trace,
+                           uint64_t vaddr,
+                           const void *data,
+                           size_t size)
+{
+	const uint8_t *bytes = data;
+
+	while (size > 0) {
+		gt_binary_record *record = gt_binary_trace_reserve(trace);
+		size_t chunk = MIN(size, sizeof record->args);
+
+		memset(record, 0x00, sizeof *record);
+		record->type   = GT_BINARY_RECORD_MEMORY;
+		record->retval = vaddr;
+		record->size   = chunk;
+		memcpy(record->args, bytes, chunk);
+
+		gt_binary_trace_commit(trace);
+
+		bytes += chunk;
+		vaddr += chunk;
+		size  -= chunk;
+	}
+}
+
+void
+gt_binary_trace_close(gt_binary_trace *trace)
+{
+	if (NULL == trace) {
+		goto done;
+	}
+
+	msync(trace->map, trace->map_size, MS_SYNC);
+	munmap(trace->map, trace->map_size);
+	close(trace->fd);
+
+	g_free(trace);
+
+done:
+	return;
+}
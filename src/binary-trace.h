@@ -0,0 +1,81 @@
+#ifndef BINARY_TRACE_H
+#define BINARY_TRACE_H
+
+#include <stdint.h>
+
+#include "guestrace.h"
+
+/*
+ * A binary trace is a file which guestrace maps into memory and treats as a
+ * ring of fixed-size records. The file begins with a gt_binary_trace_header,
+ * followed by a table of NUL-terminated system-call names (indexed by the
+ * syscall field of each record), followed by the ring itself. Once the ring
+ * fills, new records overwrite the oldest records. Tools such as
+ * tools/guestrace-decode render the records after the fact, and
+ * gt_replay_loop_new() replays them to callbacks.
+ *
+ * A trace which captures memory (see "guestrace -C") precedes each call or
+ * return record with the guest memory which the decoder read while
+ * servicing that event, in GT_BINARY_RECORD_MEMORY records. Each of these
+ * holds up to sizeof args bytes, which begin at the virtual address in
+ * retval; consecutive records extend one another.
+ *
+ * All fields are in the byte order of the host which wrote the trace.
+ */
+
+#define GT_BINARY_TRACE_MAGIC "GTRACEv1"
+
+#define GT_BINARY_TRACE_VERSION 1
+
+/* Number of system-call arguments each record captures. */
+#define GT_BINARY_TRACE_ARGS 6
+
+/* Number of records in a ring unless otherwise specified. */
+#define GT_BINARY_TRACE_DEFAULT_CAPACITY (1 << 20)
+
+typedef enum gt_binary_record_type {
+	GT_BINARY_RECORD_CALL   = 1,
+	GT_BINARY_RECORD_RETURN = 2,
+	GT_BINARY_RECORD_MEMORY = 3,
+} gt_binary_record_type;
+
+typedef struct gt_binary_trace_header {
+	char     magic[8];
+	uint32_t version;
+	uint32_t record_size;
+	uint32_t os;             /* GtOSType of the guest. */
+	uint32_t name_count;
+	uint64_t names_offset;
+	uint64_t names_size;
+	uint64_t records_offset;
+	uint64_t capacity;       /* Records in ring. */
+	uint64_t head;           /* Records ever written; next is head % capacity. */
+} gt_binary_trace_header;
+
+typedef struct gt_binary_record {
+	uint64_t timestamp;      /* Microseconds since the Epoch. */
+	uint64_t tid;
+	uint64_t args[GT_BINARY_TRACE_ARGS];
+	uint64_t retval;         /* Return value, or address of memory. */
+	uint32_t pid;
+	uint16_t vcpu;
+	uint16_t syscall;        /* Index into the trace's name table. */
+	uint32_t type;           /* A gt_binary_record_type. */
+	uint32_t size;           /* Bytes of args which hold memory, or zero. */
+} gt_binary_record;
+
+typedef struct gt_binary_trace gt_binary_trace;
+
+gt_binary_trace  *gt_binary_trace_open(const char *path,
+                                       uint64_t capacity,
+                                       GtOSType os,
+                                       const GtCallbackRegistry *registry);
+gt_binary_record *gt_binary_trace_reserve(gt_binary_trace *trace);
+void              gt_binary_trace_commit(gt_binary_trace *trace);
+void              gt_binary_trace_add_memory(gt_binary_trace *trace,
+                                             uint64_t vaddr,
+                                             const void *data,
+                                             size_t size);
+void              gt_binary_trace_close(gt_binary_trace *trace);
+
+#endif
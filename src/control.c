@@ -0,0 +1,273 @@
+#include <glib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "control.h"
+
+struct gt_control {
+	GtLoop    **loops;
+	guint       loop_count;
+	char       *path;
+	GIOChannel *channel;
+	guint       watch;
+};
+
+/* A command applies func to the kernel function which follows its name. */
+typedef gboolean (*gt_control_func) (GtLoop *loop, const char *kernel_func);
+
+static gboolean
+gt_control_enable(GtLoop *loop, const char *kernel_func)
+{
+	return gt_loop_set_cb_enabled(loop, kernel_func, TRUE);
+}
+
+static gboolean
+gt_control_disable(GtLoop *loop, const char *kernel_func)
+{
+	return gt_loop_set_cb_enabled(loop, kernel_func, FALSE);
+}
+
+static const struct {
+	const char      *name;
+	gt_control_func  func;
+} gt_control_commands[] = {
+	{ "enable",  gt_control_enable },
+	{ "disable", gt_control_disable },
+	{ "remove",  gt_loop_remove_cb },
+	{ NULL,      NULL },
+};
+
+/* Describe the counters of each loop, followed by "ok". */
+static char *
+gt_control_stats(gt_control *control)
+{
+	GString *reply = g_string_new(NULL);
+
+	for (guint i = 0; i < control->loop_count; i++) {
+		GtStats *stats = gt_loop_get_stats(control->loops[i]);
+		char *text = gt_stats_format(stats);
+
+		g_string_append_printf(reply,
+		                       "guest %s\n%s",
+		                       gt_loop_get_guest_name(control->loops[i]),
+		                       text);
+
+		g_free(text);
+		gt_stats_free(stats);
+	}
+
+	g_string_append(reply, "ok\n");
+
+	return g_string_free(reply, FALSE);
+}
+
+/*
+ * Carry out the command in line on each loop, and return the reply, which
+ * the caller must free. The command succeeds if it succeeds on any loop.
+ */
+static char *
+gt_control_execute(gt_control *control, char *line)
+{
+	const char *reply = "error: unknown command\n";
+	char *name, *kernel_func, *ptr;
+
+	name        = strtok_r(line, " \t\r\n", &ptr);
+	kernel_func = strtok_r(NULL, " \t\r\n", &ptr);
+
+	if (NULL != name && 0 == strcmp(name, "stats")) {
+		return gt_control_stats(control);
+	}
+
+	if (NULL == name || NULL == kernel_func) {
+		reply = "error: expected command and kernel function\n";
+		goto done;
+	}
+
+	for (int i = 0; NULL != gt_control_commands[i].name; i++) {
+		if (0 == strcmp(name, gt_control_commands[i].name)) {
+			gboolean ok = FALSE;
+
+			for (guint j = 0; j < control->loop_count; j++) {
+				ok |= gt_control_commands[i].func(control->loops[j],
+				                                  kernel_func);
+			}
+
+			reply = ok ? "ok\n" : "error: no such callback\n";
+			break;
+		}
+	}
+
+done:
+	return g_strdup(reply);
+}
+
+static gboolean
+gt_control_client_cb(GIOChannel *channel, GIOCondition condition, gpointer data)
+{
+	gt_control *control = data;
+	gboolean keep = FALSE;
+	GIOStatus status;
+	gchar *line = NULL;
+
+	if (!(condition & G_IO_IN)) {
+		goto done;
+	}
+
+	status = g_io_channel_read_line(channel, &line, NULL, NULL, NULL);
+	if (G_IO_STATUS_AGAIN == status) {
+		keep = TRUE;
+		goto done;
+	}
+
+	if (G_IO_STATUS_NORMAL != status) {
+		goto done;
+	}
+
+	char *reply = gt_control_execute(control, line);
+
+	g_io_channel_write_chars(channel, reply, -1, NULL, NULL);
+	g_io_channel_flush(channel, NULL);
+	g_free(reply);
+
+	keep = TRUE;
+
+done:
+	g_free(line);
+
+	if (!keep) {
+		g_io_channel_unref(channel);
+	}
+
+	return keep;
+}
+
+static gboolean
+gt_control_accept_cb(GIOChannel *channel, GIOCondition condition, gpointer data)
+{
+	gt_control *control = data;
+	GIOChannel *client;
+	int fd;
+
+	fd = accept(g_io_channel_unix_get_fd(channel), NULL, NULL);
+	if (-1 == fd) {
+		perror("failed to accept control connection");
+		goto done;
+	}
+
+	client = g_io_channel_unix_new(fd);
+	g_io_channel_set_close_on_unref(client, TRUE);
+
+	/* Ensure a partial line never blocks the event loop. */
+	g_io_channel_set_flags(client, G_IO_FLAG_NONBLOCK, NULL);
+
+	gt_loop_add_watch(client,
+	                  G_IO_IN | G_IO_HUP | G_IO_ERR,
+	                  gt_control_client_cb,
+	                  control);
+
+done:
+	return TRUE;
+}
+
+/*
+ * Listen for control commands on a UNIX-domain socket at path, and apply
+ * each command to all loop_count loops. The default main context services
+ * the commands; a loop which runs on its own thread (see gt_loop_start())
+ * pauses between guest events to carry them out. Only the user running
+ * guestrace may connect, since commands can stop tracing; an existing file
+ * at path is replaced only if it is a socket.
+ */
+gt_control *
+gt_control_open(GtLoop **loops, guint loop_count, const char *path)
+{
+	int fd = -1, rc;
+	mode_t mask;
+	struct stat st;
+	gt_control *control = NULL;
+	struct sockaddr_un addr = { .sun_family = AF_UNIX };
+
+	if (strlen(path) >= sizeof(addr.sun_path)) {
+		fprintf(stderr, "control socket path too long\n");
+		goto done;
+	}
+
+	strcpy(addr.sun_path, path);
+
+	fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (-1 == fd) {
+		perror("failed to create control socket");
+		goto done;
+	}
+
+	if (0 == lstat(path, &st)) {
+		if (!S_ISSOCK(st.st_mode)) {
+			fprintf(stderr, "%s exists and is not a socket\n", path);
+			goto done;
+		}
+
+		unlink(path);
+	} else if (ENOENT != errno) {
+		perror("failed to inspect control socket path");
+		goto done;
+	}
+
+	mask = umask(077);
+	rc = bind(fd, (struct sockaddr *) &addr, sizeof(addr));
+	umask(mask);
+	if (-1 == rc) {
+		perror("failed to bind control socket");
+		goto done;
+	}
+
+	rc = listen(fd, 4);
+	if (-1 == rc) {
+		perror("failed to listen on control socket");
+		goto done;
+	}
+
+	control          = g_new0(gt_control, 1);
+	control->loops      = g_new(GtLoop *, loop_count);
+	control->loop_count = loop_count;
+	control->path       = g_strdup(path);
+	memcpy(control->loops, loops, loop_count * sizeof *loops);
+	control->channel = g_io_channel_unix_new(fd);
+	g_io_channel_set_close_on_unref(control->channel, TRUE);
+
+	control->watch = gt_loop_add_watch(control->channel,
+	                                   G_IO_IN,
+	                                   gt_control_accept_cb,
+	                                   control);
+
+	fd = -1;
+
+done:
+	if (-1 != fd) {
+		close(fd);
+	}
+
+	return control;
+}
+
+void
+gt_control_close(gt_control *control)
+{
+	if (NULL == control) {
+		goto done;
+	}
+
+	g_source_remove(control->watch);
+	g_io_channel_unref(control->channel);
+	unlink(control->path);
+
+	g_free(control->path);
+	g_free(control->loops);
+	g_free(control);
+
+done:
+	return;
+}
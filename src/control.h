@@ -0,0 +1,28 @@
+#ifndef CONTROL_H
+#define CONTROL_H
+
+#include "guestrace.h"
+
+/*
+ * A control channel is a UNIX-domain socket on which guestrace accepts
+ * commands while it runs. Each command is a line of text:
+ *
+ * 	enable <kernel function>
+ * 	disable <kernel function>
+ * 	remove <kernel function>
+ * 	stats
+ *
+ * Each command applies to every guest which guestrace monitors. Guestrace
+ * answers each with a line which reads "ok" or begins "error"; "stats"
+ * first describes the counters of each guest, as gt_stats_format() does.
+ * For example:
+ *
+ * 	$ echo "disable sys_read" | socat - UNIX-CONNECT:/run/guestrace.sock
+ */
+
+typedef struct gt_control gt_control;
+
+gt_control *gt_control_open(GtLoop **loops, guint loop_count, const char *path);
+void        gt_control_close(gt_control *control);
+
+#endif
@@ -0,0 +1,508 @@
+#include <glib.h>
+#include <string.h>
+
+#include "args.h"
+#include "decoder.h"
+
+/* Passed from decode_syscall_saved to decode_sysret_saved. */
+struct gt_decode_call {
+	const gt_decode_hook *hook;
+	gt_reg_t              saved[];
+};
+
+struct gt_win64_obj_attr {
+	uint32_t length;
+	uint64_t root_directory;
+	uint64_t object_name;   /* Pointer to a UNICODE_STRING. */
+	uint32_t attributes;
+	uint64_t security_descriptor;
+	uint64_t security_quality_of_service;
+};
+
+/*
+ * The capture spec: the bytes which the decoder reads at an argument of each
+ * kind, before following the pointers in them. Kinds which are absent read
+ * nothing, or, like GT_ARG_CSTR, read a string of unknown length.
+ */
+static const gsize CAPTURE_SIZE[] = {
+	[GT_ARG_USTR]              = sizeof(struct gt_win64_unicode_string),
+	[GT_ARG_OBJECT_ATTRIBUTES] = sizeof(struct gt_win64_obj_attr),
+	[GT_ARG_PVALUE]            = sizeof(gt_reg_t),
+};
+
+/* The structures which decode_capture() read for one argument. */
+typedef struct gt_decode_capture {
+	struct gt_win64_obj_attr       obj_attr;     /* GT_ARG_OBJECT_ATTRIBUTES. */
+	struct gt_win64_unicode_string ustr;         /* Or the object's name. */
+	gboolean                       has_obj_attr;
+	gboolean                       has_ustr;
+} gt_decode_capture;
+
+enum {
+	FILE_READ_DATA        = 0x000001,
+	FILE_LIST_DIRECTORY   = 0x000001,
+	FILE_WRITE_DATA       = 0x000002,
+	FILE_ADD_FILE         = 0x000002,
+	FILE_APPEND_DATA      = 0x000004,
+	FILE_ADD_SUBDIRECTORY = 0x000004,
+	FILE_READ_EA          = 0x000008,
+	FILE_WRITE_EA         = 0x000010,
+	FILE_EXECUTE          = 0x000020,
+	FILE_TRAVERSE         = 0x000020,
+	FILE_DELETE_CHILD     = 0x000040,
+	FILE_READ_ATTRIBUTES  = 0x000080,
+	FILE_WRITE_ATTRIBUTES = 0x000100,
+	DELETE                = 0x010000,
+	READ_CONTROL          = 0x020000,
+	WRITE_DAC             = 0x040000,
+	WRITE_OWNER           = 0x080000,
+	SYNCHRONIZE           = 0x100000,
+	OWNER                 = FILE_READ_DATA | FILE_LIST_DIRECTORY | FILE_WRITE_DATA |
+	                        FILE_ADD_FILE  | FILE_APPEND_DATA    | FILE_ADD_SUBDIRECTORY |
+	                        FILE_READ_EA   | FILE_WRITE_EA       | FILE_EXECUTE |
+	                        FILE_TRAVERSE  | FILE_DELETE_CHILD   | FILE_READ_ATTRIBUTES |
+	                        FILE_WRITE_ATTRIBUTES | DELETE       | READ_CONTROL |
+	                        WRITE_DAC      | WRITE_OWNER         | SYNCHRONIZE,
+	READ_ONLY             = FILE_READ_DATA | FILE_LIST_DIRECTORY | FILE_READ_EA |
+	                        FILE_EXECUTE   | FILE_TRAVERSE | FILE_READ_ATTRIBUTES |
+	                        READ_CONTROL   | SYNCHRONIZE,
+	CONTRIBUTOR           = OWNER & ~(FILE_DELETE_CHILD | WRITE_DAC | WRITE_OWNER),
+};
+
+static const struct {
+	uint32_t    mask;
+	const char *name;
+} ACCESS_FLAGS[] = {
+	{ FILE_READ_DATA,        "FILE_READ_DATA" },
+	{ FILE_LIST_DIRECTORY,   "FILE_LIST_DIRECTORY" },
+	{ FILE_WRITE_DATA,       "FILE_WRITE_DATA" },
+	{ FILE_ADD_FILE,         "FILE_ADD_FILE" },
+	{ FILE_APPEND_DATA,      "FILE_APPEND_DATA" },
+	{ FILE_ADD_SUBDIRECTORY, "FILE_ADD_SUBDIRECTORY" },
+	{ FILE_READ_EA,          "FILE_READ_EA" },
+	{ FILE_WRITE_EA,         "FILE_WRITE_EA" },
+	{ FILE_EXECUTE,          "FILE_EXECUTE" },
+	{ FILE_TRAVERSE,         "FILE_TRAVERSE" },
+	{ FILE_DELETE_CHILD,     "FILE_DELETE_CHILD" },
+	{ FILE_READ_ATTRIBUTES,  "FILE_READ_ATTRIBUTES" },
+	{ FILE_WRITE_ATTRIBUTES, "FILE_WRITE_ATTRIBUTES" },
+	{ DELETE,                "DELETE" },
+	{ READ_CONTROL,          "READ_CONTROL" },
+	{ WRITE_DAC,             "WRITE_DAC" },
+	{ WRITE_OWNER,           "WRITE_OWNER" },
+	{ SYNCHRONIZE,           "SYNCHRONIZE" },
+};
+
+/* Return the names of the flags in permissions, separated by '|'. */
+static char *
+access_mask_to_string(uint32_t permissions)
+{
+	GString *flags;
+
+	if (OWNER == permissions) {
+		return g_strdup("OWNER");
+	}
+
+	if (READ_ONLY == permissions) {
+		return g_strdup("READ_ONLY");
+	}
+
+	if (CONTRIBUTOR == permissions) {
+		return g_strdup("CONTRIBUTOR");
+	}
+
+	flags = g_string_new(NULL);
+
+	for (gsize i = 0; i < G_N_ELEMENTS(ACCESS_FLAGS); i++) {
+		if (permissions & ACCESS_FLAGS[i].mask) {
+			if (flags->len > 0) {
+				g_string_append_c(flags, '|');
+			}
+			g_string_append(flags, ACCESS_FLAGS[i].name);
+		}
+	}
+
+	if (0 == flags->len) {
+		g_string_append(flags, "NONE");
+	}
+
+	return g_string_free(flags, FALSE);
+}
+
+/* Read the OBJECT_ATTRIBUTES at vaddr, trusting its length no further than our struct. */
+static gboolean
+obj_attr_read(GtArgs *args, gt_addr_t vaddr, struct gt_win64_obj_attr *obj_attr)
+{
+	gboolean ok = FALSE;
+	uint32_t struct_size = 0;
+
+	memset(obj_attr, 0x00, sizeof *obj_attr);
+
+	if (!gt_args_read(args, vaddr, &struct_size, sizeof struct_size)) {
+		goto done;
+	}
+
+	struct_size = MIN(struct_size, sizeof *obj_attr);
+
+	ok = gt_args_read(args, vaddr, obj_attr, struct_size);
+
+done:
+	return ok;
+}
+
+/* Return the string of the UNICODE_STRING ustr as UTF-8, or NULL on error. */
+static char *
+ustr_decode(GtArgs *args, const struct gt_win64_unicode_string *ustr)
+{
+	char *utf8 = NULL;
+	gsize length = MIN(ustr->length, GT_ARGS_MAX_STRING) / sizeof(gunichar2);
+	gunichar2 *utf16 = g_new(gunichar2, length + 1);
+
+	if (gt_args_read(args, ustr->buffer, utf16, length * sizeof *utf16)) {
+		utf8 = g_utf16_to_utf8(utf16, length, NULL, NULL, NULL);
+	}
+
+	g_free(utf16);
+
+	return utf8;
+}
+
+/* Read the UNICODE_STRING at vaddr into ustr, and describe its string in next. */
+static gboolean
+ustr_read(GtArgs *args, gt_addr_t vaddr, struct gt_win64_unicode_string *ustr, GtArgsRange *next)
+{
+	gboolean ok = 0 != vaddr && gt_args_read(args, vaddr, ustr, sizeof *ustr);
+
+	if (ok) {
+		*next = (GtArgsRange) { ustr->buffer, MIN(ustr->length, GT_ARGS_MAX_STRING) };
+	}
+
+	return ok;
+}
+
+/*
+ * Read the memory of each argument in mask, whose values are in values,
+ * into captures. Each pointer the decoder follows depends on the structure
+ * before it, so capture every argument's structures, then their strings and
+ * object names, then the strings of those names: one gt_args_capture() per
+ * level rather than a chain of reads per argument.
+ */
+static void
+decode_capture(GtArgs *args,
+               const gt_syscall_desc *desc,
+               guint32 mask,
+               const gt_reg_t *values,
+               gt_decode_capture *captures)
+{
+	GtArgsRange ranges[GT_DECODE_MAX_ARGS];
+	guint count = 0;
+
+	for (guint i = 0; i < desc->arg_count; i++) {
+		if (mask & (1u << i)) {
+			ranges[count++] = (GtArgsRange) { values[i], CAPTURE_SIZE[desc->args[i].kind] };
+		}
+	}
+
+	gt_args_capture(args, ranges, count);
+
+	count = 0;
+
+	for (guint i = 0; i < desc->arg_count; i++) {
+		gt_decode_capture *capture = &captures[i];
+
+		if (!(mask & (1u << i))) {
+			continue;
+		}
+
+		memset(capture, 0x00, sizeof *capture);
+
+		switch (desc->args[i].kind) {
+		case GT_ARG_USTR:
+			capture->has_ustr = ustr_read(args, values[i], &capture->ustr, &ranges[count]);
+			count += capture->has_ustr;
+			break;
+		case GT_ARG_OBJECT_ATTRIBUTES:
+			capture->has_obj_attr = 0 != values[i]
+			                     && obj_attr_read(args, values[i], &capture->obj_attr);
+			if (capture->has_obj_attr) {
+				ranges[count++] = (GtArgsRange) {
+					capture->obj_attr.object_name,
+					sizeof capture->ustr,
+				};
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	gt_args_capture(args, ranges, count);
+
+	count = 0;
+
+	for (guint i = 0; i < desc->arg_count; i++) {
+		gt_decode_capture *capture = &captures[i];
+
+		if ((mask & (1u << i)) && capture->has_obj_attr) {
+			capture->has_ustr = ustr_read(args,
+			                              capture->obj_attr.object_name,
+			                              &capture->ustr,
+			                              &ranges[count]);
+			count += capture->has_ustr;
+		}
+	}
+
+	gt_args_capture(args, ranges, count);
+}
+
+/*
+ * Interpret raw, the value of the argument desc describes. Capture holds
+ * what decode_capture() read, if desc's kind has a capture spec.
+ */
+static void
+decode_arg(GtArgs *args,
+           const gt_arg_desc *desc,
+           gt_reg_t raw,
+           const gt_decode_capture *capture,
+           gt_decoded_arg *out)
+{
+	*out = (gt_decoded_arg) { .desc = desc, .raw = raw, .value = raw };
+
+	switch (desc->kind) {
+	case GT_ARG_CSTR:
+		out->string = gt_args_read_string(args, raw);
+		break;
+	case GT_ARG_USTR:
+		if (capture->has_ustr) {
+			out->string = ustr_decode(args, &capture->ustr);
+		}
+		break;
+	case GT_ARG_OBJECT_ATTRIBUTES:
+		if (capture->has_obj_attr) {
+			out->string         = capture->has_ustr ? ustr_decode(args, &capture->ustr) : NULL;
+			out->root_directory = capture->obj_attr.root_directory;
+			out->attributes     = capture->obj_attr.attributes;
+		}
+		break;
+	case GT_ARG_ACCESS_MASK:
+		out->string = access_mask_to_string(raw);
+		break;
+	case GT_ARG_PVALUE:
+		out->value = 0;
+		gt_args_read(args, raw, &out->value, sizeof out->value);
+		break;
+	default:
+		break;
+	}
+}
+
+/*
+ * Decode those arguments of desc whose direction includes direction,
+ * capturing the memory of those in capture first. The values come from
+ * saved if not NULL, and otherwise from args. Returns the number of
+ * arguments decoded into decoded.
+ */
+static guint
+decode_args(GtArgs *args,
+            const gt_syscall_desc *desc,
+            gt_arg_direction direction,
+            guint32 capture,
+            const gt_reg_t *saved,
+            gt_decoded_arg *decoded)
+{
+	gt_reg_t values[GT_DECODE_MAX_ARGS];
+	gt_decode_capture captures[GT_DECODE_MAX_ARGS];
+	guint count = 0;
+
+	for (guint i = 0; i < desc->arg_count; i++) {
+		if (desc->args[i].direction & direction) {
+			values[i] = NULL == saved ? gt_args_get(args, i) : saved[i];
+		}
+	}
+
+	if (0 != capture) {
+		decode_capture(args, desc, capture, values, captures);
+	}
+
+	for (guint i = 0; i < desc->arg_count; i++) {
+		const gt_arg_desc *arg = &desc->args[i];
+
+		if (!(arg->direction & direction)) {
+			continue;
+		}
+
+		decode_arg(args, arg, values[i], &captures[i], &decoded[count++]);
+	}
+
+	return count;
+}
+
+static void
+decoded_free(gt_decoded_arg *decoded, guint count)
+{
+	for (guint i = 0; i < count; i++) {
+		g_free(decoded[i].string);
+	}
+}
+
+static void
+decode_call(const gt_decode_event *event)
+{
+	gt_sink *sink = event->hook->sink;
+	gt_decoded_arg decoded[GT_DECODE_MAX_ARGS];
+	guint count = 0;
+
+	if (sink->decode) {
+		count = decode_args(gt_guest_get_args(event->state),
+		                    event->hook->desc,
+		                    GT_ARG_IN,
+		                    event->hook->capture_in,
+		                    NULL,
+		                    decoded);
+	}
+
+	sink->call(sink, event, decoded, count);
+
+	decoded_free(decoded, count);
+}
+
+static void
+decode_return(const gt_decode_event *event, const gt_reg_t *saved)
+{
+	gt_sink *sink = event->hook->sink;
+	gt_decoded_arg decoded[GT_DECODE_MAX_ARGS];
+	guint count = 0;
+
+	if (NULL != saved) {
+		count = decode_args(gt_guest_get_args(event->state),
+		                    event->hook->desc,
+		                    GT_ARG_OUT,
+		                    event->hook->capture_out,
+		                    saved,
+		                    decoded);
+	}
+
+	sink->ret(sink,
+	          event,
+	          gt_guest_get_register(event->state, RAX),
+	          decoded,
+	          count);
+
+	decoded_free(decoded, count);
+}
+
+/* The call of a system call which has no OUT arguments to show on return. */
+static void *
+decode_syscall(GtGuestState *state, gt_pid_t pid, gt_tid_t tid, void *user_data)
+{
+	decode_call(&(gt_decode_event) { state, pid, tid, user_data });
+
+	return user_data;
+}
+
+static void
+decode_sysret(GtGuestState *state, gt_pid_t pid, gt_tid_t tid, void *user_data)
+{
+	decode_return(&(gt_decode_event) { state, pid, tid, user_data }, NULL);
+}
+
+/*
+ * The call of a system call which has OUT arguments. The kernel and the
+ * caller reuse the registers and stack slots which held the arguments, so
+ * save the pointers for decoding once the kernel fills them in.
+ */
+static void *
+decode_syscall_saved(GtGuestState *state, gt_pid_t pid, gt_tid_t tid, void *user_data)
+{
+	const gt_decode_hook *hook = user_data;
+	GtArgs *args = gt_guest_get_args(state);
+	struct gt_decode_call *call;
+
+	decode_call(&(gt_decode_event) { state, pid, tid, hook });
+
+	call = g_malloc(sizeof *call + hook->saved_count * sizeof call->saved[0]);
+	call->hook = hook;
+
+	for (guint i = 0; i < hook->saved_count; i++) {
+		call->saved[i] = gt_args_get(args, i);
+	}
+
+	return call;
+}
+
+static void
+decode_sysret_saved(GtGuestState *state, gt_pid_t pid, gt_tid_t tid, void *user_data)
+{
+	struct gt_decode_call *call = user_data;
+
+	decode_return(&(gt_decode_event) { state, pid, tid, call->hook }, call->saved);
+
+	g_free(call);
+}
+
+/*
+ * Prepare hook to pass each call of the system call desc describes, and its
+ * return if returns, to sink; and point entry's callbacks at the decoder.
+ * Index is the position of entry in its registry.
+ */
+void
+gt_decode_hook_init(gt_decode_hook *hook,
+                    gt_sink *sink,
+                    const gt_syscall_desc *desc,
+                    guint index,
+                    gboolean returns,
+                    GtCallbackRegistry *entry)
+{
+	g_assert(desc->arg_count <= GT_DECODE_MAX_ARGS);
+
+	hook->sink        = sink;
+	hook->desc        = desc;
+	hook->index       = index;
+	hook->saved_count = 0;
+	hook->capture_in  = 0;
+	hook->capture_out = 0;
+
+	/* The capture spec of each argument follows from its kind. */
+	for (guint i = 0; i < desc->arg_count; i++) {
+		const gt_arg_desc *arg = &desc->args[i];
+
+		if (arg->kind >= G_N_ELEMENTS(CAPTURE_SIZE) || 0 == CAPTURE_SIZE[arg->kind]) {
+			continue;
+		}
+
+		if (arg->direction & GT_ARG_IN) {
+			hook->capture_in |= 1u << i;
+		}
+
+		if (arg->direction & GT_ARG_OUT) {
+			hook->capture_out |= 1u << i;
+		}
+	}
+
+	if (returns && sink->decode) {
+		for (guint i = 0; i < desc->arg_count; i++) {
+			if (desc->args[i].direction & GT_ARG_OUT) {
+				hook->saved_count = i + 1;
+			}
+		}
+	}
+
+	entry->name       = (char *) desc->name;
+	entry->user_data  = hook;
+
+	if (0 == hook->saved_count) {
+		entry->syscall_cb = decode_syscall;
+		entry->sysret_cb  = returns ? decode_sysret : NULL;
+	} else {
+		entry->syscall_cb = decode_syscall_saved;
+		entry->sysret_cb  = decode_sysret_saved;
+	}
+}
+
+void
+gt_sink_free(gt_sink *sink)
+{
+	if (NULL != sink) {
+		sink->free(sink);
+	}
+}
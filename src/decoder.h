@@ -0,0 +1,112 @@
+#ifndef DECODER_H
+#define DECODER_H
+
+#include <glib.h>
+
+#include "guestrace.h"
+
+/*
+ * The generated system-call tables describe each system call as data: its
+ * name, and the kind and direction of each of its arguments. A single
+ * decoder interprets these descriptions at run time, and passes the decoded
+ * arguments to a sink which formats them as text, JSON, binary records, or
+ * whatever else an output mode requires.
+ */
+
+/* Upper bound on the number of arguments of any described system call. */
+#define GT_DECODE_MAX_ARGS 18
+
+/* How to interpret the value of an argument. */
+typedef enum gt_arg_kind {
+	GT_ARG_PTR,               /* Opaque value; print in hexadecimal. */
+	GT_ARG_UINT,              /* Unsigned integer. */
+	GT_ARG_INT,               /* Signed 32-bit integer. */
+	GT_ARG_LONG,              /* Signed 64-bit integer. */
+	GT_ARG_CSTR,              /* Pointer to a NUL-terminated string. */
+	GT_ARG_USTR,              /* Pointer to a Windows UNICODE_STRING. */
+	GT_ARG_OBJECT_ATTRIBUTES, /* Pointer to a Windows OBJECT_ATTRIBUTES. */
+	GT_ARG_ACCESS_MASK,       /* Windows ACCESS_MASK. */
+	GT_ARG_BOOLEAN,           /* Windows BOOLEAN. */
+	GT_ARG_PVALUE,            /* Pointer to a 64-bit value, such as a PHANDLE. */
+} gt_arg_kind;
+
+/* Whether the caller, the kernel, or both fill in an argument. */
+typedef enum gt_arg_direction {
+	GT_ARG_IN    = 1 << 0,
+	GT_ARG_OUT   = 1 << 1,
+	GT_ARG_INOUT = GT_ARG_IN | GT_ARG_OUT,
+} gt_arg_direction;
+
+typedef struct gt_arg_desc {
+	const char *name;      /* NULL if the table does not name arguments. */
+	guint8      kind;      /* A gt_arg_kind. */
+	guint8      direction; /* A mask of gt_arg_direction. */
+} gt_arg_desc;
+
+/* An array of these, terminated by a NULL name, describes an OS. */
+typedef struct gt_syscall_desc {
+	const char        *name;
+	const gt_arg_desc *args;
+	guint8             arg_count;
+} gt_syscall_desc;
+
+/* An argument after decoding; which fields are valid depends on the kind. */
+typedef struct gt_decoded_arg {
+	const gt_arg_desc *desc;
+	gt_reg_t           raw;            /* The argument itself. */
+	gt_reg_t           value;          /* GT_ARG_PVALUE: the value pointed to. */
+	gt_reg_t           root_directory; /* GT_ARG_OBJECT_ATTRIBUTES. */
+	gt_reg_t           attributes;     /* GT_ARG_OBJECT_ATTRIBUTES. */
+	char              *string;         /* String, object name, or access flags; might be NULL. */
+} gt_decoded_arg;
+
+typedef struct gt_sink gt_sink;
+typedef struct gt_decode_hook gt_decode_hook;
+
+/* The event which a sink formats. */
+typedef struct gt_decode_event {
+	GtGuestState         *state;
+	gt_pid_t              pid;
+	gt_tid_t              tid;
+	const gt_decode_hook *hook;
+} gt_decode_event;
+
+/*
+ * A sink receives each call and return along with the arguments the decoder
+ * decoded: the IN arguments of a call, and the OUT arguments of a return.
+ * A sink which clears decode receives no decoded arguments, and the decoder
+ * neither reads guest memory nor saves arguments for it.
+ */
+struct gt_sink {
+	gboolean decode;
+	void   (*call) (gt_sink *sink,
+	                const gt_decode_event *event,
+	                const gt_decoded_arg *args,
+	                guint count);
+	void   (*ret)  (gt_sink *sink,
+	                const gt_decode_event *event,
+	                gt_reg_t retval,
+	                const gt_decoded_arg *args,
+	                guint count);
+	void   (*free) (gt_sink *sink);
+};
+
+/* Passed as user_data to the callbacks which gt_decode_hook_init() installs. */
+struct gt_decode_hook {
+	gt_sink               *sink;
+	const gt_syscall_desc *desc;
+	guint                  index;       /* Index in the guest's registry. */
+	guint                  saved_count; /* Arguments to save for the return. */
+	guint32                capture_in;  /* IN arguments whose memory to capture. */
+	guint32                capture_out; /* OUT arguments whose memory to capture. */
+};
+
+void gt_decode_hook_init(gt_decode_hook *hook,
+                         gt_sink *sink,
+                         const gt_syscall_desc *desc,
+                         guint index,
+                         gboolean returns,
+                         GtCallbackRegistry *entry);
+void gt_sink_free(gt_sink *sink);
+
+#endif
@@ -0,0 +1,426 @@
+#include <glib.h>
+#include <libvmi/libvmi.h>
+#include <libvmi/events.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "deferred.h"
+
+/*
+ * This code moves the work of callbacks registered with
+ * gt_loop_set_deferred_cb() off of the thread which services libvmi events.
+ * While the event thread handles a breakpoint, the guest VCPU which hit the
+ * breakpoint remains paused. Thus the event thread merely copies the guest's
+ * registers, along with whatever memory the registration's GtCaptureFunc
+ * reads, into a GtEventSnapshot. It then places the snapshot on the queue of
+ * a worker thread and immediately returns to the guest. The worker later
+ * invokes the registration's GtDeferredFunc on the snapshot.
+ *
+ * Each worker owns a single-producer, single-consumer ring, so neither side
+ * takes a lock on its fast path. The event thread chooses a worker by
+ * thread ID, so the call and return of a given guest thread land in the
+ * same ring in order. A worker sleeps on its condition variable only after
+ * finding its ring empty. If a ring fills, the event thread drops the new
+ * snapshot rather than wait for the worker; gt_deferred_stop() reports the
+ * number of drops.
+ */
+
+/* Number of entries in each worker's ring; must be a power of two. */
+#define GT_DEFERRED_RING_SIZE 4096
+
+/* Number of workers unless a caller invokes gt_loop_set_deferred_workers(). */
+#define GT_DEFERRED_DEFAULT_WORKERS 1
+
+/* A set of callbacks registered with gt_loop_set_deferred_cb(). */
+typedef struct gt_deferred_registration {
+	GtLoop        *loop;
+	GtCaptureFunc  capture_cb;
+	GtDeferredFunc syscall_cb;
+	GtDeferredFunc sysret_cb;
+	void          *user_data;
+} gt_deferred_registration;
+
+typedef struct gt_deferred_entry {
+	GtDeferredFunc  func;
+	void           *user_data;
+	GtEventSnapshot snapshot;
+} gt_deferred_entry;
+
+typedef struct gt_deferred_worker {
+	GThread           *thread;
+	GMutex             lock;
+	GCond              cond;
+
+	/* Written only by event thread. */
+	gint               head;
+	guint              dropped;
+
+	/* Written only by worker. */
+	gint               tail;
+
+	/* Set when worker might block on cond. */
+	gboolean           sleeping;
+	gboolean           stopping;
+
+	gt_deferred_entry  ring[GT_DEFERRED_RING_SIZE];
+} gt_deferred_worker;
+
+static gpointer
+gt_deferred_worker_run(gpointer data)
+{
+	gt_deferred_worker *worker = data;
+
+	while (TRUE) {
+		guint tail = g_atomic_int_get(&worker->tail);
+
+		if (tail == (guint) g_atomic_int_get(&worker->head)) {
+			gboolean stopping;
+
+			g_mutex_lock(&worker->lock);
+			g_atomic_int_set(&worker->sleeping, TRUE);
+
+			/* Recheck now that event thread will signal us. */
+			while (tail == (guint) g_atomic_int_get(&worker->head)
+			    && !worker->stopping) {
+				g_cond_wait(&worker->cond, &worker->lock);
+			}
+
+			worker->sleeping = FALSE;
+			stopping = worker->stopping;
+			g_mutex_unlock(&worker->lock);
+
+			/* Drain ring before honoring stop request. */
+			if (stopping && tail == (guint) g_atomic_int_get(&worker->head)) {
+				break;
+			}
+
+			continue;
+		}
+
+		gt_deferred_entry *entry = &worker->ring[tail % GT_DEFERRED_RING_SIZE];
+		entry->func(&entry->snapshot, entry->user_data);
+
+		g_atomic_int_set(&worker->tail, tail + 1);
+	}
+
+	return NULL;
+}
+
+/* Start loop's worker threads; the caller holds loop->lock. */
+static void
+gt_deferred_start_workers(GtLoop *loop)
+{
+	if (0 == loop->deferred_worker_count) {
+		loop->deferred_worker_count = GT_DEFERRED_DEFAULT_WORKERS;
+	}
+
+	loop->deferred_workers = g_new0(gt_deferred_worker,
+	                                loop->deferred_worker_count);
+
+	for (guint i = 0; i < loop->deferred_worker_count; i++) {
+		gt_deferred_worker *worker = &loop->deferred_workers[i];
+
+		g_mutex_init(&worker->lock);
+		g_cond_init(&worker->cond);
+		worker->thread = g_thread_new("gt-deferred",
+		                              gt_deferred_worker_run,
+		                              worker);
+	}
+}
+
+/*
+ * Return the free ring entry which the event thread should fill on behalf of
+ * thread tid, or NULL if that entry's ring is full.
+ */
+static gt_deferred_entry *
+gt_deferred_reserve(GtLoop *loop, gt_tid_t tid, gt_deferred_worker **worker)
+{
+	gt_deferred_entry *entry = NULL;
+	guint head, index;
+
+	/* Kernel stacks are aligned, so mix in the high bits of tid. */
+	index   = ((tid * 0x9E3779B97F4A7C15ull) >> 32) % loop->deferred_worker_count;
+	*worker = &loop->deferred_workers[index];
+
+	head = (*worker)->head;
+	if (head - (guint) g_atomic_int_get(&(*worker)->tail) >= GT_DEFERRED_RING_SIZE) {
+		(*worker)->dropped++;
+		goto done;
+	}
+
+	entry = &(*worker)->ring[head % GT_DEFERRED_RING_SIZE];
+
+done:
+	return entry;
+}
+
+/* Make the entry most recently returned by gt_deferred_reserve() visible. */
+static void
+gt_deferred_commit(gt_deferred_worker *worker)
+{
+	g_atomic_int_set(&worker->head, worker->head + 1);
+
+	/* A full barrier orders the head update before reading sleeping. */
+	if (g_atomic_int_get(&worker->sleeping)) {
+		g_mutex_lock(&worker->lock);
+		g_cond_signal(&worker->cond);
+		g_mutex_unlock(&worker->lock);
+	}
+}
+
+static void
+gt_deferred_snapshot(GtEventSnapshot *snapshot,
+                     GtGuestState *state,
+                     gt_pid_t pid,
+                     gt_tid_t tid)
+{
+	vmi_event_t *event = gt_guest_get_vmi_event(state);
+
+	snapshot->timestamp = g_get_real_time();
+	snapshot->pid       = pid;
+	snapshot->tid       = tid;
+	snapshot->vcpu      = event->vcpu_id;
+	snapshot->regs      = *event->x86_regs;
+	snapshot->captured  = 0;
+}
+
+/*
+ * The GtSyscallFunc which gt_loop_set_deferred_cb() registers on behalf of
+ * the caller. Returns the registration, so gt_deferred_sysret_cb() can find
+ * it.
+ */
+static void *
+gt_deferred_syscall_cb(GtGuestState *state,
+                       gt_pid_t pid,
+                       gt_tid_t tid,
+                       void *user_data)
+{
+	gt_deferred_registration *reg = user_data;
+	gt_deferred_worker *worker;
+	gt_deferred_entry *entry;
+
+	if (NULL == reg->syscall_cb) {
+		goto done;
+	}
+
+	entry = gt_deferred_reserve(reg->loop, tid, &worker);
+	if (NULL == entry) {
+		goto done;
+	}
+
+	entry->func      = reg->syscall_cb;
+	entry->user_data = reg->user_data;
+
+	gt_deferred_snapshot(&entry->snapshot, state, pid, tid);
+
+	if (NULL != reg->capture_cb) {
+		entry->snapshot.captured = reg->capture_cb(state,
+		                                           pid,
+		                                           tid,
+		                                           entry->snapshot.capture,
+		                                           sizeof entry->snapshot.capture,
+		                                           reg->user_data);
+		g_assert(entry->snapshot.captured <= sizeof entry->snapshot.capture);
+	}
+
+	gt_deferred_commit(worker);
+
+done:
+	return reg;
+}
+
+static void
+gt_deferred_sysret_cb(GtGuestState *state,
+                      gt_pid_t pid,
+                      gt_tid_t tid,
+                      void *data)
+{
+	gt_deferred_registration *reg = data;
+	gt_deferred_worker *worker;
+	gt_deferred_entry *entry;
+
+	if (NULL == reg->sysret_cb) {
+		goto done;
+	}
+
+	entry = gt_deferred_reserve(reg->loop, tid, &worker);
+	if (NULL == entry) {
+		goto done;
+	}
+
+	entry->func      = reg->sysret_cb;
+	entry->user_data = reg->user_data;
+
+	gt_deferred_snapshot(&entry->snapshot, state, pid, tid);
+
+	gt_deferred_commit(worker);
+
+done:
+	return;
+}
+
+/**
+ * gt_loop_set_deferred_cb:
+ * @loop: a #GtLoop.
+ * @kernel_func: the name of a function in the traced kernel which implements
+ * a system call.
+ * @capture_cb: a #GtCaptureFunc which copies guest memory into the snapshot
+ * passed to @syscall_cb, or NULL.
+ * @syscall_cb: a #GtDeferredFunc which will handle the named system call, or
+ * NULL.
+ * @sysret_cb: a #GtDeferredFunc which will handle returns from the named
+ * system call, or NULL.
+ * @user_data: optional data which the guestrace event loop will pass to each
+ * call of @capture_cb, @syscall_cb, and @sysret_cb.
+ *
+ * Like gt_loop_set_cb(), but @syscall_cb and @sysret_cb run on a worker
+ * thread after the guest resumes rather than while the guest VCPU waits.
+ * They receive a #GtEventSnapshot instead of a #GtGuestState, and thus cannot
+ * read guest memory. Any guest memory they need must be copied by
+ * @capture_cb, which runs at the time of the system call. The snapshot passed
+ * to @sysret_cb contains only registers. As with gt_loop_set_cb(), a NULL
+ * @sysret_cb avoids trapping returns altogether.
+ *
+ * Because several workers might run at once, @syscall_cb and @sysret_cb must
+ * be safe to call concurrently for different guest threads.
+ *
+ * May be called while @loop runs, as may gt_loop_set_cb(); the first such
+ * registration starts the workers.
+ *
+ * Returns: %TRUE on success, %FALSE on failure.
+ **/
+gboolean
+gt_loop_set_deferred_cb(GtLoop *loop,
+                        const char *kernel_func,
+                        GtCaptureFunc capture_cb,
+                        GtDeferredFunc syscall_cb,
+                        GtDeferredFunc sysret_cb,
+                        void *user_data)
+{
+	gboolean ok;
+	gt_deferred_registration *reg;
+
+	g_rec_mutex_lock(&loop->lock);
+
+	/* Have workers before the first call can reach them. */
+	if (loop->deferred_started && NULL == loop->deferred_workers) {
+		gt_deferred_start_workers(loop);
+	}
+
+	reg = g_new0(gt_deferred_registration, 1);
+	reg->loop       = loop;
+	reg->capture_cb = capture_cb;
+	reg->syscall_cb = syscall_cb;
+	reg->sysret_cb  = sysret_cb;
+	reg->user_data  = user_data;
+
+	ok = gt_loop_set_cb(loop,
+	                    kernel_func,
+	                    gt_deferred_syscall_cb,
+	                    NULL == sysret_cb ? NULL : gt_deferred_sysret_cb,
+	                    reg);
+	if (!ok) {
+		g_free(reg);
+		goto done;
+	}
+
+	if (NULL == loop->deferred_registrations) {
+		loop->deferred_registrations = g_ptr_array_new_with_free_func(g_free);
+	}
+
+	g_ptr_array_add(loop->deferred_registrations, reg);
+
+done:
+	g_rec_mutex_unlock(&loop->lock);
+
+	return ok;
+}
+
+/**
+ * gt_loop_set_deferred_workers:
+ * @loop: a #GtLoop.
+ * @workers: the number of worker threads.
+ *
+ * Sets the number of worker threads which will run the callbacks registered
+ * by gt_loop_set_deferred_cb(). Must be called before gt_loop_run(). The
+ * default is one worker, which ensures deferred callbacks never run
+ * concurrently.
+ */
+void
+gt_loop_set_deferred_workers(GtLoop *loop, guint workers)
+{
+	g_assert(NULL == loop->deferred_workers);
+
+	loop->deferred_worker_count = MAX(workers, 1);
+}
+
+/*
+ * Start the worker threads if anything registered a deferred callback, or
+ * else leave gt_loop_set_deferred_cb() to start them.
+ */
+void
+gt_deferred_start(GtLoop *loop)
+{
+	g_rec_mutex_lock(&loop->lock);
+
+	loop->deferred_started = TRUE;
+
+	if (NULL != loop->deferred_registrations && NULL == loop->deferred_workers) {
+		gt_deferred_start_workers(loop);
+	}
+
+	g_rec_mutex_unlock(&loop->lock);
+}
+
+/* Wait for each worker to drain its ring, and then join it. */
+void
+gt_deferred_stop(GtLoop *loop)
+{
+	guint dropped = 0;
+
+	/* The loop no longer services events, so none can reach a worker. */
+	g_rec_mutex_lock(&loop->lock);
+	loop->deferred_started = FALSE;
+	g_rec_mutex_unlock(&loop->lock);
+
+	if (NULL == loop->deferred_workers) {
+		goto done;
+	}
+
+	for (guint i = 0; i < loop->deferred_worker_count; i++) {
+		gt_deferred_worker *worker = &loop->deferred_workers[i];
+
+		g_mutex_lock(&worker->lock);
+		worker->stopping = TRUE;
+		g_cond_signal(&worker->cond);
+		g_mutex_unlock(&worker->lock);
+
+		g_thread_join(worker->thread);
+
+		g_mutex_clear(&worker->lock);
+		g_cond_clear(&worker->cond);
+
+		dropped += worker->dropped;
+	}
+
+	if (0 != dropped) {
+		fprintf(stderr, "deferred queues dropped %u events\n", dropped);
+	}
+
+	g_free(loop->deferred_workers);
+	loop->deferred_workers = NULL;
+
+done:
+	return;
+}
+
+void
+gt_deferred_free(GtLoop *loop)
+{
+	gt_deferred_stop(loop);
+
+	if (NULL != loop->deferred_registrations) {
+		g_ptr_array_free(loop->deferred_registrations, TRUE);
+		loop->deferred_registrations = NULL;
+	}
+}
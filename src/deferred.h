@@ -0,0 +1,11 @@
+#ifndef DEFERRED_H
+#define DEFERRED_H
+
+#include "guestrace.h"
+#include "guestrace-private.h"
+
+void gt_deferred_start(GtLoop *loop);
+void gt_deferred_stop(GtLoop *loop);
+void gt_deferred_free(GtLoop *loop);
+
+#endif
@@ -1,4 +1,5 @@
 #include <libvmi/libvmi.h>
+#include <libvmi/events.h>
 
 #include "early-boot.h"
 #include "trace-syscalls.h"
@@ -32,7 +33,11 @@ early_boot_wait_for_os_load(GtLoop *loop)
 			break;
 		}
 
-		usleep(100000);
+		/* Sleep, but wake at once if gt_loop_quit() is called. */
+		if (!_gt_loop_wait(loop, 100, FALSE)) {
+			status = VMI_FAILURE;
+			goto done;
+		}
 	}
 
 	loop->lstar_addr = lstar;
@@ -57,14 +62,13 @@ done:
 static event_response_t
 gt_cr3_cb(vmi_instance_t vmi, vmi_event_t *event) {
 	GtLoop *loop = event->data;
-	static addr_t prev = 0;
 
-	if (prev != 0 && prev != event->x86_regs->cr3) {
+	if (loop->prev_cr3 != 0 && loop->prev_cr3 != event->x86_regs->cr3) {
 		vmi_clear_event(loop->vmi, event, NULL);
 		loop->initialized = TRUE;
 	}
 
-	prev = event->x86_regs->cr3;
+	loop->prev_cr3 = event->x86_regs->cr3;
 
 	return VMI_EVENT_RESPONSE_NONE;
 }
@@ -86,9 +90,8 @@ early_boot_wait_for_first_process(GtLoop *loop)
 	}
 
 	while (!loop->initialized) {
-		status_t status = vmi_events_listen(loop->vmi, 100);
-		if (status != VMI_SUCCESS) {
-			fprintf(stderr, "error waiting for events\n");
+		if (!_gt_loop_wait(loop, -1, TRUE)) {
+			status = VMI_FAILURE;
 			goto done;
 		}
 	}
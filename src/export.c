@@ -0,0 +1,596 @@
+#define _GNU_SOURCE /* fopencookie() */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <glib.h>
+#include <inttypes.h>
+#include <netdb.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "export.h"
+
+typedef struct gt_export_frame {
+	gsize  length;  /* Bytes of data in use, including the header. */
+	gsize  sent;    /* Bytes of data written to the socket. */
+	gsize  records;
+	guint8 data[GT_EXPORT_FRAME_SIZE];
+} gt_export_frame;
+
+struct gt_export {
+	/* Held from gt_export_reserve() to gt_export_commit(), and by writes. */
+	GMutex                lock;
+	int                   fd;
+	GIOChannel           *channel;
+	guint                 watch;       /* Writes ready frames, or 0. */
+	guint                 timer;       /* Closes the current frame. */
+	gt_export_frame_type  type;
+	gt_export_policy      policy;
+	gt_export_frame      *current;     /* Frame which events fill, or NULL. */
+	GQueue                ready;       /* Closed frames, oldest first. */
+	GSList               *spare;       /* Frames to reuse. */
+	guint                 frames;      /* Frames allocated. */
+	guint                 frame_limit;
+	gboolean              broken;      /* The collector has gone away. */
+	FILE                 *stream;      /* Feeds lines of JSON to frames. */
+	GString              *line;        /* Partial line written to stream. */
+	guint64               sequence;    /* Frames closed. */
+	guint64               frames_sent;
+	guint64               bytes_sent;
+	guint64               records_sent;
+	guint64               dropped;     /* Records discarded. */
+	guint64               stalls;      /* Times an event waited for a frame. */
+};
+
+/* Return an empty frame, or NULL if every frame is in use. */
+static gt_export_frame *
+export_frame_take(gt_export *export)
+{
+	gt_export_frame *frame = NULL;
+
+	if (NULL != export->spare) {
+		frame         = export->spare->data;
+		export->spare = g_slist_delete_link(export->spare, export->spare);
+	} else if (export->frames < export->frame_limit) {
+		frame = g_new(gt_export_frame, 1);
+		export->frames++;
+	} else {
+		goto done;
+	}
+
+	frame->length  = sizeof(gt_export_frame_header);
+	frame->sent    = 0;
+	frame->records = 0;
+
+done:
+	return frame;
+}
+
+static void
+export_frame_release(gt_export *export, gt_export_frame *frame)
+{
+	export->spare = g_slist_prepend(export->spare, frame);
+}
+
+static gboolean export_writable_cb(GIOChannel *channel,
+                                   GIOCondition condition,
+                                   gpointer data);
+
+/* Fill in the header of frame, and queue it behind the frames ready to send. */
+static void
+export_queue(gt_export *export, gt_export_frame *frame, gt_export_frame_type type)
+{
+	gt_export_frame_header *header = (gt_export_frame_header *) frame->data;
+
+	header->magic    = GT_EXPORT_MAGIC;
+	header->type     = type;
+	header->size     = frame->length - sizeof *header;
+	header->records  = frame->records;
+	header->sequence = export->sequence++;
+	header->dropped  = export->dropped;
+
+	g_queue_push_tail(&export->ready, frame);
+
+	if (0 == export->watch) {
+		export->watch = gt_loop_add_watch(export->channel,
+		                                  G_IO_OUT | G_IO_ERR | G_IO_HUP,
+		                                  export_writable_cb,
+		                                  export);
+	}
+}
+
+/* Queue the current frame if it holds any events. */
+static void
+export_close_current(gt_export *export)
+{
+	if (NULL != export->current && 0 != export->current->records) {
+		export_queue(export, export->current, export->type);
+		export->current = NULL;
+	}
+}
+
+/* Give up on the collector, counting the events which it will never see. */
+static void
+export_break(gt_export *export)
+{
+	gt_export_frame *frame;
+
+	export->broken = TRUE;
+
+	if (NULL != export->current) {
+		export->dropped += export->current->records;
+		export_frame_release(export, export->current);
+		export->current = NULL;
+	}
+
+	while (NULL != (frame = g_queue_pop_head(&export->ready))) {
+		/* The HELLO frame holds names rather than events. */
+		if (GT_EXPORT_FRAME_HELLO != ((gt_export_frame_header *) frame->data)->type) {
+			export->dropped += frame->records;
+		}
+		export_frame_release(export, frame);
+	}
+}
+
+/*
+ * Write the ready frames to the socket until it would block or, if blocking,
+ * until none remain. The caller must hold lock.
+ */
+static void
+export_write(gt_export *export, gboolean blocking)
+{
+	while (!export->broken && !g_queue_is_empty(&export->ready)) {
+		gt_export_frame *frame = g_queue_peek_head(&export->ready);
+		ssize_t count;
+
+		count = send(export->fd,
+		             frame->data + frame->sent,
+		             frame->length - frame->sent,
+		             MSG_NOSIGNAL);
+		if (-1 == count) {
+			struct pollfd writable = { .fd = export->fd, .events = POLLOUT };
+
+			if (EINTR == errno) {
+				continue;
+			}
+
+			if (EAGAIN != errno && EWOULDBLOCK != errno) {
+				perror("failed to write to export socket");
+				export_break(export);
+				break;
+			}
+
+			if (!blocking) {
+				break;
+			}
+
+			poll(&writable, 1, -1);
+			continue;
+		}
+
+		frame->sent        += count;
+		export->bytes_sent += count;
+
+		if (frame->sent == frame->length) {
+			g_queue_pop_head(&export->ready);
+
+			if (GT_EXPORT_FRAME_HELLO != ((gt_export_frame_header *) frame->data)->type) {
+				export->records_sent += frame->records;
+			}
+
+			export->frames_sent++;
+			export_frame_release(export, frame);
+		}
+	}
+}
+
+static gboolean
+export_writable_cb(GIOChannel *channel, GIOCondition condition, gpointer data)
+{
+	gt_export *export = data;
+	gboolean keep;
+
+	g_mutex_lock(&export->lock);
+
+	if (condition & (G_IO_ERR | G_IO_HUP)) {
+		fprintf(stderr, "export collector closed the connection\n");
+		export_break(export);
+	}
+
+	export_write(export, FALSE);
+
+	keep = !export->broken && !g_queue_is_empty(&export->ready);
+	if (!keep) {
+		export->watch = 0;
+	}
+
+	g_mutex_unlock(&export->lock);
+
+	return keep;
+}
+
+static gboolean
+export_timer_cb(gpointer data)
+{
+	gt_export *export = data;
+
+	g_mutex_lock(&export->lock);
+	export_close_current(export);
+	g_mutex_unlock(&export->lock);
+
+	return G_SOURCE_CONTINUE;
+}
+
+/*
+ * Split what the JSON sink writes to stream into lines, and make each line a
+ * record, so that a dropped event never leaves half an object in a frame.
+ */
+static ssize_t
+export_stream_write(void *cookie, const char *buf, size_t size)
+{
+	gt_export *export = cookie;
+	const char *end = buf + size;
+
+	while (buf < end) {
+		const char *newline = memchr(buf, '\n', end - buf);
+		gpointer record;
+
+		if (NULL == newline) {
+			g_string_append_len(export->line, buf, end - buf);
+			break;
+		}
+
+		g_string_append_len(export->line, buf, newline + 1 - buf);
+
+		record = gt_export_reserve(export, export->line->len);
+		if (NULL != record) {
+			memcpy(record, export->line->str, export->line->len);
+			gt_export_commit(export);
+		}
+
+		g_string_truncate(export->line, 0);
+		buf = newline + 1;
+	}
+
+	return size;
+}
+
+/*
+ * Connect to address, which is either "unix:<path>" or "<host>:<port>".
+ * Returns the socket, or -1.
+ */
+static int
+export_connect(const char *address)
+{
+	int fd = -1, rc;
+	char *host = NULL;
+	const char *port;
+	struct addrinfo hints = { .ai_socktype = SOCK_STREAM }, *info = NULL;
+
+	if (g_str_has_prefix(address, "unix:")) {
+		struct sockaddr_un addr = { .sun_family = AF_UNIX };
+		const char *path = address + strlen("unix:");
+
+		if (strlen(path) >= sizeof(addr.sun_path)) {
+			fprintf(stderr, "export socket path too long\n");
+			goto done;
+		}
+
+		strcpy(addr.sun_path, path);
+
+		fd = socket(AF_UNIX, SOCK_STREAM, 0);
+		if (-1 == fd) {
+			perror("failed to create export socket");
+			goto done;
+		}
+
+		rc = connect(fd, (struct sockaddr *) &addr, sizeof(addr));
+		if (-1 == rc) {
+			perror("failed to connect export socket");
+			close(fd);
+			fd = -1;
+		}
+
+		goto done;
+	}
+
+	port = strrchr(address, ':');
+	if (NULL == port || address == port) {
+		fprintf(stderr, "export address must be <host>:<port> or unix:<path>\n");
+		goto done;
+	}
+
+	/* Allow "[::1]:port". */
+	if ('[' == address[0] && ']' == port[-1]) {
+		host = g_strndup(address + 1, port - address - 2);
+	} else {
+		host = g_strndup(address, port - address);
+	}
+
+	rc = getaddrinfo(host, port + 1, &hints, &info);
+	if (0 != rc) {
+		fprintf(stderr, "could not resolve %s: %s\n", host, gai_strerror(rc));
+		goto done;
+	}
+
+	for (struct addrinfo *i = info; NULL != i; i = i->ai_next) {
+		fd = socket(i->ai_family, i->ai_socktype, i->ai_protocol);
+		if (-1 == fd) {
+			continue;
+		}
+
+		if (0 == connect(fd, i->ai_addr, i->ai_addrlen)) {
+			break;
+		}
+
+		close(fd);
+		fd = -1;
+	}
+
+	if (-1 == fd) {
+		fprintf(stderr, "could not connect to %s\n", address);
+	}
+
+done:
+	if (NULL != info) {
+		freeaddrinfo(info);
+	}
+
+	g_free(host);
+
+	return fd;
+}
+
+/* Queue the HELLO frame, which names the guest and its system calls. */
+static gboolean
+export_hello(gt_export *export,
+             GtOSType os,
+             const char *guest,
+             const GtCallbackRegistry *registry)
+{
+	gboolean ok = FALSE;
+	gt_export_frame *frame = export_frame_take(export);
+	GString *payload = g_string_new(NULL);
+	uint32_t os_type = os;
+
+	g_string_append_len(payload, (const char *) &os_type, sizeof os_type);
+	g_string_append_len(payload, guest, strlen(guest) + 1);
+
+	for (guint i = 0; NULL != registry[i].name; i++) {
+		g_string_append_len(payload, registry[i].name, strlen(registry[i].name) + 1);
+		frame->records++;
+	}
+
+	if (frame->length + payload->len > GT_EXPORT_FRAME_SIZE) {
+		fprintf(stderr, "export HELLO frame too large\n");
+		export_frame_release(export, frame);
+		goto done;
+	}
+
+	memcpy(frame->data + frame->length, payload->str, payload->len);
+	frame->length += payload->len;
+
+	export_queue(export, frame, GT_EXPORT_FRAME_HELLO);
+
+	ok = TRUE;
+
+done:
+	g_string_free(payload, TRUE);
+
+	return ok;
+}
+
+/*
+ * Connect to the collector at address, and announce the guest, whose OS is
+ * os and whose system calls registry names. Allocates at most frames frames,
+ * or GT_EXPORT_DEFAULT_FRAMES if frames is zero; see export.h. Returns NULL
+ * on failure.
+ */
+gt_export *
+gt_export_open(const char *address,
+               gt_export_frame_type type,
+               gt_export_policy policy,
+               guint frames,
+               GtOSType os,
+               const char *guest,
+               const GtCallbackRegistry *registry)
+{
+	gt_export *export = NULL;
+	int fd, flags;
+
+	fd = export_connect(address);
+	if (-1 == fd) {
+		goto done;
+	}
+
+	flags = fcntl(fd, F_GETFL);
+	if (-1 == flags || -1 == fcntl(fd, F_SETFL, flags | O_NONBLOCK)) {
+		perror("failed to make export socket non-blocking");
+		close(fd);
+		goto done;
+	}
+
+	export              = g_new0(gt_export, 1);
+	export->fd          = fd;
+	export->channel     = g_io_channel_unix_new(fd);
+	export->type        = type;
+	export->policy      = policy;
+	export->frame_limit = 0 == frames ? GT_EXPORT_DEFAULT_FRAMES : frames;
+	export->line        = g_string_new(NULL);
+
+	g_mutex_init(&export->lock);
+	g_queue_init(&export->ready);
+	g_io_channel_set_close_on_unref(export->channel, TRUE);
+
+	if (!export_hello(export, os, guest, registry)) {
+		gt_export_close(export);
+		export = NULL;
+		goto done;
+	}
+
+	if (GT_EXPORT_FRAME_JSON == type) {
+		cookie_io_functions_t functions = { .write = export_stream_write };
+
+		export->stream = fopencookie(export, "w", functions);
+		if (NULL == export->stream) {
+			perror("failed to open export stream");
+			gt_export_close(export);
+			export = NULL;
+			goto done;
+		}
+
+		setvbuf(export->stream, NULL, _IOLBF, BUFSIZ);
+	}
+
+	export->timer = g_timeout_add(GT_EXPORT_FLUSH_INTERVAL, export_timer_cb, export);
+
+done:
+	return export;
+}
+
+/*
+ * Return size bytes in the current frame for the caller to fill in, or NULL
+ * if the export has dropped the event. If the return value is not NULL, the
+ * caller must call gt_export_commit() once it has filled in the record; in
+ * the meantime, no other thread can add to the export.
+ */
+gpointer
+gt_export_reserve(gt_export *export, gsize size)
+{
+	gpointer record = NULL;
+
+	g_mutex_lock(&export->lock);
+
+	if (size > GT_EXPORT_FRAME_SIZE - sizeof(gt_export_frame_header)) {
+		goto drop;
+	}
+
+	if (NULL != export->current && export->current->length + size > GT_EXPORT_FRAME_SIZE) {
+		export_queue(export, export->current, export->type);
+		export->current = NULL;
+	}
+
+	while (NULL == export->current && !export->broken) {
+		export->current = export_frame_take(export);
+		if (NULL != export->current || GT_EXPORT_POLICY_DROP == export->policy) {
+			break;
+		}
+
+		/* Every frame waits for the socket, so wait with them. */
+		export->stalls++;
+		export_write(export, TRUE);
+	}
+
+	if (NULL == export->current) {
+		goto drop;
+	}
+
+	record = export->current->data + export->current->length;
+	export->current->length += size;
+
+	goto done;
+
+drop:
+	export->dropped++;
+	g_mutex_unlock(&export->lock);
+
+done:
+	return record;
+}
+
+/* Add the record which gt_export_reserve() returned to its frame. */
+void
+gt_export_commit(gt_export *export)
+{
+	export->current->records++;
+
+	g_mutex_unlock(&export->lock);
+}
+
+/*
+ * Return a stream which adds each line written to it to the export as a
+ * record, or NULL if the export's frames hold binary records.
+ */
+FILE *
+gt_export_get_stream(gt_export *export)
+{
+	return export->stream;
+}
+
+/* Return a description of the export's counters, which the caller must free. */
+char *
+gt_export_format_stats(gt_export *export)
+{
+	char *text;
+
+	g_mutex_lock(&export->lock);
+
+	text = g_strdup_printf("export: %"PRIu64" records in %"PRIu64" frames "
+	                       "(%"PRIu64" bytes) sent, %"PRIu64" records dropped, "
+	                       "%"PRIu64" stalls, %u frames waiting%s\n",
+	                       export->records_sent,
+	                       export->frames_sent,
+	                       export->bytes_sent,
+	                       export->dropped,
+	                       export->stalls,
+	                       g_queue_get_length(&export->ready),
+	                       export->broken ? ", disconnected" : "");
+
+	g_mutex_unlock(&export->lock);
+
+	return text;
+}
+
+/*
+ * Send the events which remain, waiting for the socket if necessary, and
+ * close the export. The guest's loop must have stopped.
+ */
+void
+gt_export_close(gt_export *export)
+{
+	gt_export_frame *frame;
+
+	if (NULL == export) {
+		goto done;
+	}
+
+	if (NULL != export->stream) {
+		fclose(export->stream);
+	}
+
+	if (0 != export->timer) {
+		g_source_remove(export->timer);
+	}
+
+	g_mutex_lock(&export->lock);
+
+	export_close_current(export);
+	export_write(export, TRUE);
+
+	if (0 != export->watch) {
+		g_source_remove(export->watch);
+	}
+
+	g_mutex_unlock(&export->lock);
+
+	if (NULL != export->current) {
+		export_frame_release(export, export->current);
+	}
+
+	while (NULL != (frame = g_queue_pop_head(&export->ready))) {
+		export_frame_release(export, frame);
+	}
+
+	g_slist_free_full(export->spare, g_free);
+	g_io_channel_unref(export->channel);
+	g_string_free(export->line, TRUE);
+	g_mutex_clear(&export->lock);
+	g_free(export);
+
+done:
+	return;
+}
@@ -0,0 +1,78 @@
+#ifndef EXPORT_H
+#define EXPORT_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "guestrace.h"
+
+/*
+ * An export streams encoded events to a collector over a TCP or UNIX-domain
+ * socket, so that traces leave Dom0 without touching its disks. Events
+ * collect in frames of up to GT_EXPORT_FRAME_SIZE bytes, and the default
+ * main context writes each full frame as the socket accepts it; a timer
+ * closes a partly-filled frame every GT_EXPORT_FLUSH_INTERVAL milliseconds,
+ * so that a quiet guest's events still leave promptly.
+ *
+ * At most a fixed number of frames wait for the socket. Once they are all
+ * full, an export with GT_EXPORT_POLICY_DROP discards new events and counts
+ * them, so that a slow collector never stalls the guest; one with
+ * GT_EXPORT_POLICY_BLOCK instead writes to the socket from the thread which
+ * services the event until a frame is free.
+ *
+ * The stream begins with a GT_EXPORT_FRAME_HELLO frame whose payload holds
+ * the guest's GtOSType as a uint32_t, then the NUL-terminated name of the
+ * guest, then the NUL-terminated name of each system call in the guest's
+ * registry; the header's records field counts these names. Each later frame
+ * holds gt_binary_record structures, or lines of JSON, according to the
+ * export's type. All fields are in the byte order of the host which sent
+ * them.
+ */
+
+#define GT_EXPORT_MAGIC 0x58455447 /* "GTEX" */
+
+/* Largest frame, including its header. */
+#define GT_EXPORT_FRAME_SIZE (256 * 1024)
+
+/* Frames which may wait for the socket unless otherwise specified. */
+#define GT_EXPORT_DEFAULT_FRAMES 64
+
+/* Milliseconds between flushes of a partly-filled frame. */
+#define GT_EXPORT_FLUSH_INTERVAL 100
+
+typedef enum gt_export_frame_type {
+	GT_EXPORT_FRAME_HELLO  = 1,
+	GT_EXPORT_FRAME_BINARY = 2,
+	GT_EXPORT_FRAME_JSON   = 3,
+} gt_export_frame_type;
+
+typedef enum gt_export_policy {
+	GT_EXPORT_POLICY_DROP,
+	GT_EXPORT_POLICY_BLOCK,
+} gt_export_policy;
+
+typedef struct gt_export_frame_header {
+	uint32_t magic;
+	uint32_t type;     /* A gt_export_frame_type. */
+	uint32_t size;     /* Bytes of payload which follow the header. */
+	uint32_t records;  /* Records, lines or names in the payload. */
+	uint64_t sequence; /* Frames sent before this one. */
+	uint64_t dropped;  /* Records dropped before this frame was sent. */
+} gt_export_frame_header;
+
+typedef struct gt_export gt_export;
+
+gt_export *gt_export_open(const char *address,
+                          gt_export_frame_type type,
+                          gt_export_policy policy,
+                          guint frames,
+                          GtOSType os,
+                          const char *guest,
+                          const GtCallbackRegistry *registry);
+gpointer   gt_export_reserve(gt_export *export, gsize size);
+void       gt_export_commit(gt_export *export);
+FILE      *gt_export_get_stream(gt_export *export);
+char      *gt_export_format_stats(gt_export *export);
+void       gt_export_close(gt_export *export);
+
+#endif
@@ -0,0 +1,229 @@
+#include <glib.h>
+#include <libvmi/libvmi.h>
+#include <libvmi/events.h>
+
+#include "filter.h"
+#include "guestrace-private.h"
+
+/*
+ * A filter decides whether the guestrace event loop should service a system
+ * call. Guestrace consults filters before invoking a GtSyscallFunc and
+ * before hijacking the call's return address, so a rejected call costs one
+ * VM exit rather than two.
+ */
+
+typedef struct gt_register_mask {
+	gt_reg_name_t reg;
+	gt_reg_t      mask;
+	gt_reg_t      value;
+} gt_register_mask;
+
+struct _GtFilter {
+	/* <private> */
+	gint          ref_count;
+	GHashTable   *pids;
+	GHashTable   *cr3s;
+	GPatternSpec *process_name;
+	GArray       *register_masks;
+};
+
+/**
+ * gt_filter_new:
+ *
+ * Creates a new #GtFilter which accepts every system call. Each of the
+ * gt_filter_add_* and gt_filter_set_* functions then adds a criterion. A
+ * filter accepts a system call only if the call satisfies every criterion;
+ * a call satisfies a set of PIDs or CR3 values if it matches any member.
+ *
+ * Returns: a new #GtFilter with a reference count of one.
+ **/
+GtFilter *
+gt_filter_new(void)
+{
+	GtFilter *filter = g_new0(GtFilter, 1);
+
+	filter->ref_count      = 1;
+	filter->register_masks = g_array_new(FALSE, FALSE, sizeof(gt_register_mask));
+
+	return filter;
+}
+
+/**
+ * gt_filter_ref:
+ * @filter: a #GtFilter.
+ *
+ * Increases the reference count of @filter by one.
+ *
+ * Returns: @filter.
+ **/
+GtFilter *
+gt_filter_ref(GtFilter *filter)
+{
+	filter->ref_count++;
+
+	return filter;
+}
+
+/**
+ * gt_filter_unref:
+ * @filter: a #GtFilter, or NULL.
+ *
+ * Decreases the reference count of @filter by one, and frees @filter once
+ * no references remain.
+ **/
+void
+gt_filter_unref(GtFilter *filter)
+{
+	if (NULL == filter || 0 != --filter->ref_count) {
+		goto done;
+	}
+
+	if (NULL != filter->pids) {
+		g_hash_table_destroy(filter->pids);
+	}
+
+	if (NULL != filter->cr3s) {
+		g_hash_table_destroy(filter->cr3s);
+	}
+
+	if (NULL != filter->process_name) {
+		g_pattern_spec_free(filter->process_name);
+	}
+
+	g_array_free(filter->register_masks, TRUE);
+	g_free(filter);
+
+done:
+	return;
+}
+
+/**
+ * gt_filter_add_pid:
+ * @filter: a #GtFilter.
+ * @pid: a process ID.
+ *
+ * Causes @filter to accept system calls made by the process @pid. Once a
+ * filter has any PIDs, it rejects system calls made by all other processes.
+ **/
+void
+gt_filter_add_pid(GtFilter *filter, gt_pid_t pid)
+{
+	if (NULL == filter->pids) {
+		filter->pids = g_hash_table_new(NULL, NULL);
+	}
+
+	g_hash_table_add(filter->pids, GINT_TO_POINTER(pid));
+}
+
+/**
+ * gt_filter_add_cr3:
+ * @filter: a #GtFilter.
+ * @cr3: the value of CR3 while a process of interest runs.
+ *
+ * Causes @filter to accept system calls made from the address space @cr3.
+ * Once a filter has any CR3 values, it rejects system calls made from all
+ * other address spaces. Guestrace ignores the PCID bits of CR3.
+ **/
+void
+gt_filter_add_cr3(GtFilter *filter, gt_addr_t cr3)
+{
+	if (NULL == filter->cr3s) {
+		filter->cr3s = g_hash_table_new(NULL, NULL);
+	}
+
+	g_hash_table_add(filter->cr3s, GSIZE_TO_POINTER(cr3 & ~GT_CR3_PCID_MASK));
+}
+
+/**
+ * gt_filter_set_process_name:
+ * @filter: a #GtFilter.
+ * @pattern: a glob pattern, as understood by #GPatternSpec.
+ *
+ * Causes @filter to accept only those system calls made by processes whose
+ * name, as returned by gt_guest_get_process_name(), matches @pattern.
+ **/
+void
+gt_filter_set_process_name(GtFilter *filter, const char *pattern)
+{
+	if (NULL != filter->process_name) {
+		g_pattern_spec_free(filter->process_name);
+	}
+
+	filter->process_name = g_pattern_spec_new(pattern);
+}
+
+/**
+ * gt_filter_add_register_mask:
+ * @filter: a #GtFilter.
+ * @reg: the register to test.
+ * @mask: the bits of @reg to test.
+ * @value: the value the bits must hold.
+ *
+ * Causes @filter to accept only those system calls for which the bits in
+ * @mask of register @reg at the time of the call equal @value. As an
+ * example, a mask of O_WRONLY | O_RDWR on RSI restricts open to writers.
+ **/
+void
+gt_filter_add_register_mask(GtFilter *filter,
+                            gt_reg_name_t reg,
+                            gt_reg_t mask,
+                            gt_reg_t value)
+{
+	gt_register_mask register_mask = { reg, mask, value & mask };
+
+	g_array_append_val(filter->register_masks, register_mask);
+}
+
+/*
+ * Determine whether filter accepts the system call described by state. A
+ * NULL filter accepts every call. Tests run from cheapest to most expensive.
+ */
+gboolean
+gt_filter_match(GtFilter *filter, GtGuestState *state, gt_pid_t pid)
+{
+	gboolean match = TRUE;
+
+	if (NULL == filter) {
+		goto done;
+	}
+
+	if (NULL != filter->cr3s) {
+		addr_t cr3 = gt_guest_get_vmi_event(state)->x86_regs->cr3;
+
+		if (!g_hash_table_contains(filter->cr3s,
+		                           GSIZE_TO_POINTER(cr3 & ~GT_CR3_PCID_MASK))) {
+			match = FALSE;
+			goto done;
+		}
+	}
+
+	for (guint i = 0; i < filter->register_masks->len; i++) {
+		gt_register_mask *register_mask = &g_array_index(filter->register_masks,
+		                                                 gt_register_mask,
+		                                                 i);
+		gt_reg_t reg = gt_guest_get_register(state, register_mask->reg);
+
+		if ((reg & register_mask->mask) != register_mask->value) {
+			match = FALSE;
+			goto done;
+		}
+	}
+
+	if (NULL != filter->pids
+	 && !g_hash_table_contains(filter->pids, GINT_TO_POINTER(pid))) {
+		match = FALSE;
+		goto done;
+	}
+
+	if (NULL != filter->process_name) {
+		const char *name = gt_guest_get_process_name(state, pid);
+
+		if (NULL == name || !g_pattern_match_string(filter->process_name, name)) {
+			match = FALSE;
+			goto done;
+		}
+	}
+
+done:
+	return match;
+}
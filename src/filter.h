@@ -0,0 +1,8 @@
+#ifndef FILTER_H
+#define FILTER_H
+
+#include "guestrace.h"
+
+gboolean gt_filter_match(GtFilter *filter, GtGuestState *state, gt_pid_t pid);
+
+#endif
@@ -1,5 +1,6 @@
 #include <libvmi/libvmi.h>
 
+#include "attach-cache.h"
 #include "guestrace.h"
 #include "guestrace-private.h"
 #include "trace-syscalls.h"
@@ -33,6 +34,101 @@ done:
 	return return_point_addr;
 }
 
+/*
+ * Walk the kernel's circular task list, beginning at init_task, to find the
+ * task with the given PID. Returns the task's name, which the caller must
+ * free, or NULL on error.
+ */
+char *
+_gt_linux_get_process_name(GtLoop *loop, gt_pid_t pid)
+{
+	char *proc = NULL;
+	addr_t list_head, list_curr;
+	unsigned long task_offset = vmi_get_offset(loop->vmi, "linux_tasks");
+	unsigned long pid_offset  = vmi_get_offset(loop->vmi, "linux_pid");
+	unsigned long name_offset = vmi_get_offset(loop->vmi, "linux_name");
+
+	list_head = gt_attach_cache_ksym2v(loop, "init_task") + task_offset;
+	if (list_head == task_offset) {
+		fprintf(stderr, "failed to read address for init_task\n");
+		goto done;
+	}
+
+	list_curr = list_head;
+
+	do {
+		gt_pid_t curr_pid = 0;
+		addr_t curr_proc = list_curr - task_offset;
+
+		status_t status = vmi_read_32_va(loop->vmi,
+		                                 curr_proc + pid_offset,
+		                                 0,
+		                      (uint32_t *) &curr_pid);
+		if (VMI_SUCCESS != status) {
+			fprintf(stderr, "failed to get the pid of a task\n");
+			goto done;
+		}
+
+		if (pid == curr_pid) {
+			proc = vmi_read_str_va(loop->vmi, curr_proc + name_offset, 0);
+			goto done;
+		}
+
+		status = vmi_read_addr_va(loop->vmi, list_curr, 0, &list_curr);
+		if (VMI_SUCCESS != status) {
+			fprintf(stderr, "failed to get the next task in the task list\n");
+			goto done;
+		}
+	} while (list_curr != list_head);
+
+done:
+	return proc;
+}
+
+/*
+ * The Linux system-call ABI passes up to six arguments in registers; see
+ * entry_SYSCALL_64.
+ */
+static gboolean
+_gt_linux_get_arg(GtArgs *args, guint index, gt_reg_t *value)
+{
+	static const gt_reg_name_t regs[] = { RDI, RSI, RDX, R10, R8, R9 };
+	gboolean ok = FALSE;
+
+	if (index >= G_N_ELEMENTS(regs)) {
+		goto done;
+	}
+
+	*value = gt_guest_get_register(args->state, regs[index]);
+	ok = TRUE;
+
+done:
+	return ok;
+}
+
+static const char * const process_create_funcs_linux[] = {
+	"sys_execve",
+	NULL
+};
+
+/* Called by fork, vfork and clone once copy_process() succeeds. */
+static const char * const process_start_funcs_linux[] = {
+	"wake_up_new_task",
+	NULL
+};
+
+/* Death by a signal reaches do_exit() without exit_group. */
+static const char * const process_exit_funcs_linux[] = {
+	"sys_exit_group",
+	"do_exit",
+	NULL
+};
+
 struct os_functions os_functions_linux = {
-	.find_return_point_addr = _gt_linux_find_return_point_addr
+	.find_return_point_addr  = _gt_linux_find_return_point_addr,
+	.get_process_name        = _gt_linux_get_process_name,
+	.get_arg                 = _gt_linux_get_arg,
+	.process_create_funcs    = process_create_funcs_linux,
+	.process_start_funcs     = process_start_funcs_linux,
+	.process_exit_funcs      = process_exit_funcs_linux,
 };
@@ -4,5 +4,6 @@
 extern struct os_functions os_functions_linux;
 
 addr_t _gt_linux_find_return_point_addr(GtLoop *loop);
+char  *_gt_linux_get_process_name(GtLoop *loop, gt_pid_t pid);
 
 #endif
@@ -33,6 +33,103 @@ done:
 	return return_point_addr;
 }
 
+/*
+ * Walk the kernel's circular process list, beginning at PsActiveProcessHead,
+ * to find the EPROCESS with the given PID. Returns the process's image name,
+ * which the caller must free, or NULL on error.
+ */
+char *
+_gt_windows_get_process_name(GtLoop *loop, gt_pid_t pid)
+{
+	char *proc = NULL;
+	addr_t list_head, list_curr;
+	unsigned long task_offset = vmi_get_offset(loop->vmi, "win_tasks");
+	unsigned long pid_offset  = vmi_get_offset(loop->vmi, "win_pid");
+	unsigned long name_offset = vmi_get_offset(loop->vmi, "win_pname");
+
+	status_t status = vmi_read_addr_ksym(loop->vmi,
+	                                    "PsActiveProcessHead",
+	                                    &list_head);
+	if (VMI_SUCCESS != status) {
+		fprintf(stderr, "failed to find PsActiveProcessHead\n");
+		goto done;
+	}
+
+	list_curr = list_head;
+
+	do {
+		gt_pid_t curr_pid = 0;
+		addr_t curr_proc = list_curr - task_offset;
+
+		status = vmi_read_32_va(loop->vmi,
+		                        curr_proc + pid_offset,
+		                        0,
+		             (uint32_t *) &curr_pid);
+		if (VMI_SUCCESS != status) {
+			fprintf(stderr, "failed to get the pid of a process\n");
+			goto done;
+		}
+
+		if (pid == curr_pid) {
+			proc = vmi_read_str_va(loop->vmi, curr_proc + name_offset, 0);
+			goto done;
+		}
+
+		status = vmi_read_addr_va(loop->vmi, list_curr, 0, &list_curr);
+		if (VMI_SUCCESS != status) {
+			fprintf(stderr, "failed to get the next process in the process list\n");
+			goto done;
+		}
+	} while (list_curr != list_head);
+
+done:
+	return proc;
+}
+
+/*
+ * The Windows x64 calling convention passes the first four arguments in
+ * registers. The rest follow the return address and the four-slot home area
+ * on the stack.
+ */
+static gboolean
+_gt_windows_get_arg(GtArgs *args, guint index, gt_reg_t *value)
+{
+	static const gt_reg_name_t regs[] = { RCX, RDX, R8, R9 };
+	gboolean ok = TRUE;
+
+	if (index < G_N_ELEMENTS(regs)) {
+		*value = gt_guest_get_register(args->state, regs[index]);
+	} else {
+		gt_addr_t rsp = gt_guest_get_register(args->state, RSP);
+		ok = gt_args_read(args, rsp + (index + 1) * sizeof(uint64_t), value, sizeof(uint64_t));
+	}
+
+	return ok;
+}
+
+static const char * const process_create_funcs_windows[] = {
+	"NtCreateUserProcess",
+	NULL
+};
+
+/* Inserts a new process into the process list before its first thread runs. */
+static const char * const process_start_funcs_windows[] = {
+	"PspInsertProcess",
+	NULL
+};
+
+/* A process also ends when its last thread calls NtTerminateThread. */
+static const char * const process_exit_funcs_windows[] = {
+	"NtTerminateProcess",
+	"NtTerminateThread",
+	NULL
+};
+
 struct os_functions os_functions_windows = {
-	.find_return_point_addr = _gt_windows_find_return_point_addr
+	.find_return_point_addr  = _gt_windows_find_return_point_addr,
+	.get_process_name        = _gt_windows_get_process_name,
+	.get_arg                 = _gt_windows_get_arg,
+	.process_create_funcs    = process_create_funcs_windows,
+	.process_start_funcs     = process_start_funcs_windows,
+	.process_exit_funcs      = process_exit_funcs_windows,
 };
@@ -3,10 +3,8 @@
 #ifndef GENERATED_LINUX_H
 #define GENERATED_LINUX_H
 
-#include "guestrace.h"
-#include "trace-syscalls.h"
+#include "decoder.h"
 
-extern const GtCallbackRegistry GT_LINUX_SYSCALLS[];
-extern const GtCallbackRegistry GT_LINUX_SILENT_SYSCALLS[];
+extern const gt_syscall_desc GT_LINUX_SYSCALLS[];
 
 #endif
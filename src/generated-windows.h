@@ -3,9 +3,8 @@
 #ifndef GENERATED_WINDOWS_H
 #define GENERATED_WINDOWS_H
 
-#include "guestrace.h"
-#include "trace-syscalls.h"
+#include "decoder.h"
 
-extern const GtCallbackRegistry GT_WINDOWS_SYSCALLS[];
+extern const gt_syscall_desc GT_WINDOWS_SYSCALLS[];
 
 #endif
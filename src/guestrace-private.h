@@ -29,15 +29,88 @@
  * mapping from physical address offsets to gt_paddr_record structures.
  * This serves as a record for each breakpoint that guestrace sets within a
  * page.
+ *
+ * The three collections above exist for setup and teardown. While servicing
+ * breakpoints, guestrace instead consults bp_index, a flat open-addressed
+ * table keyed by each type-one breakpoint's virtual address. Guestrace
+ * rebuilds bp_index after each change to the collections.
+ */
+
+/* A slot in bp_index; va is zero for an empty slot. */
+typedef struct gt_bp_slot {
+	addr_t                  va;
+	struct gt_paddr_record *record;
+} gt_bp_slot;
+
+/*
+ * A copy of the page at va in the address space dtb, made while servicing the
+ * event numbered epoch. A page whose pin_epoch is also the current epoch
+ * backs a GtStringView, so guestrace must not reuse it during the event.
+ */
+typedef struct gt_args_page {
+	guint64 epoch;
+	guint64 pin_epoch;
+	addr_t  dtb;
+	addr_t  va;
+	uint8_t data[GT_PAGE_SIZE];
+} gt_args_page;
+
+/*
+ * Bytes offset to offset + length of the page at va in the address space
+ * dtb, which gt_args_capture() read; they begin at data in the loop's
+ * args_span_data.
+ */
+typedef struct gt_args_span {
+	addr_t  dtb;
+	addr_t  va;
+	guint16 offset;
+	guint16 length;
+	guint32 data;
+} gt_args_span;
+
+/*
+ * The state of one VCPU. Each occupies its own cache lines, so that the
+ * servicing of events on one VCPU does not false-share with another.
+ * step_registered records whether step_event is ready: registered with
+ * libvmi on the VCPUs which its mask can name, and set up for
+ * vmi_toggle_single_step_vcpu() on later VCPUs.
  */
+typedef struct gt_vcpu {
+	vmi_event_t step_event;
+	gboolean    step_registered;
+	GtVcpuStats stats;
+} __attribute__((aligned(GT_CACHE_LINE_SIZE))) gt_vcpu;
+
 struct _GtLoop {
 	/* <private> */
 	GMainLoop *g_main_loop;
 
+	/* Thread created by gt_loop_start(), if any. */
+	GThread *thread;
+
+	/* Cleared by gt_loop_quit(); access atomically. */
+	gboolean running;
+
+	/*
+	 * Held by each event callback and during gt_loop_begin_update(), so
+	 * other threads can safely change the loop's callbacks. Not held while
+	 * the loop's thread waits for events.
+	 */
+	GRecMutex lock;
+
+	/*
+	 * gt_loop_quit() writes to quit_pipe to wake the thread running the
+	 * loop at once. event_fd becomes readable when libvmi has events to
+	 * service, or is -1 if libvmi cannot provide it.
+	 */
+	int quit_pipe[2];
+	int event_fd;
+
 	vmi_instance_t vmi;
 	const char *guest_name;
 
 	gboolean initialized;
+	addr_t prev_cr3; /* Used by gt_cr3_cb(). */
 	addr_t lstar_addr;
 
 	os_t os;
@@ -53,8 +126,61 @@ struct _GtLoop {
 	GHashTable *gt_page_translation;
 	GHashTable *gt_page_record_collection;
 
-	/* Contains the current mapping between a thread return ptr and gt_paddr_record */
-	GHashTable *gt_ret_addr_mapping;
+	/*
+	 * Open-addressed table of in-flight system calls, keyed by thread
+	 * return ptr; holds 1 << syscall_states_bits slots.
+	 */
+	struct gt_syscall_state *syscall_states;
+	uint8_t                  syscall_states_bits;
+	guint                    syscall_states_count;
+
+	/* Maps a PID to the gt_process_name describing that process. */
+	GHashTable *gt_process_names;
+
+	/* Maps a DTB (value of CR3) to the PID of the process which owns it. */
+	GHashTable *gt_dtb_pids;
+
+	/* Filter which applies to every callback; see also gt_paddr_record. */
+	GtFilter *filter;
+
+	/* Records of removed callbacks which a call in flight might use. */
+	GPtrArray *retired_records;
+
+	/*
+	 * The kernel function of each callback ID, and one plus the ID of
+	 * each kernel function; see _gt_loop_cb_id().
+	 */
+	GPtrArray  *cb_names;
+	GHashTable *cb_ids;
+
+	/*
+	 * State of callbacks registered with gt_loop_set_deferred_cb(), all
+	 * under lock. deferred_started records that gt_loop_run() has called
+	 * gt_deferred_start(), so that a later registration starts the workers.
+	 */
+	GPtrArray                 *deferred_registrations;
+	guint                      deferred_worker_count;
+	struct gt_deferred_worker *deferred_workers;
+	gboolean                   deferred_started;
+
+	/*
+	 * Drives the samplers of gt_loop_set_sampling() on sampling_context,
+	 * which is the context of gt_loop_run() while it runs.
+	 */
+	GMainContext *sampling_context;
+	GSource      *sampling_source;
+
+	/*
+	 * Nesting depth of gt_loop_begin_update() and the breakpoints added
+	 * since the outermost call, in case the batch aborts.
+	 */
+	guint      update_depth;
+	GPtrArray *update_records;
+	gboolean   update_aborted;
+
+	/* Flat index of breakpoints; holds 1 << bp_index_bits slots. */
+	gt_bp_slot *bp_index;
+	uint8_t     bp_index_bits;
 
 	/* Fields used to interact directly with Xen driver. */
 	xc_interface *xch;
@@ -62,11 +188,53 @@ struct _GtLoop {
 	uint32_t domid;
 	uint64_t init_mem_size;
 	uint64_t curr_mem_size;
+
+	/* Shadow pages allocated in advance by gt_loop_set_cbs(). */
+	xen_pfn_t *spare_shadow_frames;
+	unsigned long spare_shadow_frame_count;
 	uint16_t shadow_view;
 	vmi_event_t breakpoint_event;
 	vmi_event_t memory_event;
 	vmi_event_t cr3_event;
-	vmi_event_t step_event[_GT_MAX_VCPUS];
+
+	/*
+	 * With execute_only, reads and writes of shadowed pages move the VCPU
+	 * to read_view, which traps only execution of those pages, instead of
+	 * single-stepping; exec_event moves it back. read_view is zero if the
+	 * mode is off or the hardware does not support it.
+	 */
+	gboolean    execute_only;
+	uint16_t    read_view;
+	vmi_event_t exec_event;
+
+	/*
+	 * vcpu_count entries, one for each VCPU seen so far; each is allocated
+	 * separately, because libvmi holds pointers to their step events.
+	 * Grows when an event arrives from a hot-plugged VCPU. steps_enabled
+	 * records whether gt_set_up_step_events() has run, so that new VCPUs
+	 * should receive a step event too.
+	 */
+	gt_vcpu **vcpus;
+	guint     vcpu_count;
+	gboolean  steps_enabled;
+
+	/* Optional; see gt_loop_set_memory_cb(). */
+	GtMemoryFunc memory_cb;
+	void        *memory_data;
+
+	/* Non-NULL if the loop replays a trace rather than a guest; see replay.c. */
+	struct gt_replay *replay;
+
+	/* Optional; see gt_loop_set_attach_cache() and attach-cache.c. */
+	char                   *attach_cache_dir;
+	struct gt_attach_cache *attach_cache;
+
+	/*
+	 * Optional; see gt_loop_set_lazy_detach(). detaching is TRUE once
+	 * gt_loop_drain() has removed the breakpoints on calls.
+	 */
+	guint    lazy_detach_ms;
+	gboolean detaching;
 
 	/*
 	 * Two addresses relevant to type-two breakpoints, which capture system
@@ -80,10 +248,50 @@ struct _GtLoop {
 	 * servicing this breakpoint. We restore the proper control flow by
 	 * writing to RIP after servicing a type-two breakpoint.
 	 *
-	 * trampoline_addr is the address of the type-two breakpoint.
+	 * trampoline_addr is the address of the type-two breakpoint shared by
+	 * every system call which lacks a private trampoline. Each of
+	 * trampolines has its own address, found near LSTAR, and serves one
+	 * in-flight system call at a time; trampoline_offsets maps an offset
+	 * from LSTAR to one plus the index of the trampoline there, or zero.
 	 */
 	addr_t return_addr;
 	addr_t trampoline_addr;
+
+	/*
+	 * Cache of guest pages which GtArgs reads; a page is valid only during
+	 * the event whose epoch it bears. args_epoch numbers the events.
+	 * args_scratch holds the allocations which back the string views of the
+	 * event numbered args_scratch_epoch.
+	 */
+	gt_args_page *args_pages;
+	guint         args_next_page;
+	guint64       args_epoch;
+	GPtrArray    *args_scratch;
+	guint64       args_scratch_epoch;
+
+	/*
+	 * Parts of pages which gt_args_capture() read during the event
+	 * numbered args_span_epoch, in place of whole pages.
+	 */
+	GArray       *args_spans;
+	GByteArray   *args_span_data;
+	guint64       args_span_epoch;
+
+	struct gt_trampoline *trampolines;
+	guint                 trampoline_count;
+	guint                *free_trampolines;
+	guint                 free_trampoline_count;
+	uint8_t              *trampoline_offsets;
+};
+
+struct _GtArgs {
+	/* <private> */
+	GtGuestState *state;
+	guint64       epoch;    /* Zero until gt_guest_get_args(). */
+	guint32       fetched;  /* Bit i set once values[i] is decoded. */
+	gt_reg_t      values[GT_ARGS_MAX];
+	gt_pid_t      dtb_pid;  /* The PID whose DTB is dtb, if dtb is not zero. */
+	addr_t        dtb;
 };
 
 struct _GtGuestState {
@@ -91,6 +299,8 @@ struct _GtGuestState {
 	GtLoop         *loop;
 	vmi_instance_t  vmi;
         vmi_event_t    *event;
+	GtArgs          args;
+	guint           cb_id;  /* Of the callback servicing the event. */
 };
 
 #endif
@@ -1,24 +1,115 @@
+#include <glib-unix.h>
 #include <stdio.h>
 #include <signal.h>
 #include <stdlib.h>
 #include <unistd.h>
 
 #include "guestrace.h"
+#include "aggregate.h"
+#include "binary-trace.h"
+#include "control.h"
+#include "decoder.h"
+#include "export.h"
+#include "sinks.h"
 #include "generated-windows.h"
 #include "generated-linux.h"
 
-GtLoop *loop = NULL;
+/* Each guest named by -n, or trace named by -R, has its own event loop. */
+struct guest {
+	const char         *name;
+	GtLoop             *loop;
+	GtCallbackRegistry *registry;
+	gt_decode_hook     *hooks;        /* One for each entry in registry. */
+	gt_sink            *sink;         /* Formats the decoded events. */
+	gt_binary_trace    *binary_trace; /* Destination of records in binary mode. */
+	gt_aggregate       *aggregate;    /* Counters in aggregation mode. */
+	gt_export          *export;       /* Destination of events with -e. */
+};
+
+struct guest *guests = NULL;
+guint guest_count    = 0;
 
 /* Variables to hold command-line options and arguments. */
-char *name            = NULL;
+GPtrArray *names      = NULL;
 char *instrument_list = NULL;
+char *output_file     = NULL;
+char *control_path    = NULL;
+char *cache_dir       = NULL;
+char *export_address  = NULL;
+char *pid_list        = NULL;
+char *process_pattern = NULL;
+char *sampling_spec   = NULL;
+GtSampling sampling;
 gboolean silent       = FALSE;
+gboolean binary       = FALSE;
+gboolean capture      = FALSE;
+gboolean live         = FALSE;
+gboolean replay       = FALSE;
+gboolean execute_only = FALSE;
+gboolean json         = FALSE;
+gboolean export_block = FALSE;
+FILE *json_out        = NULL;
+int aggregate_interval = 0;
+int lazy_detach       = 0;
+FILE *aggregate_out   = NULL;
+gboolean call_only    = FALSE;
 gboolean verbose      = FALSE;
 
 static void
 gt_close_handler (int sig)
 {
-	gt_loop_quit(loop);
+	for (guint i = 0; i < guest_count; i++) {
+		if (NULL != guests[i].loop) {
+			gt_loop_quit(guests[i].loop);
+		}
+	}
+}
+
+/* Print the counters of each guest; see gt_loop_get_stats(). */
+static gboolean
+gt_stats_handler(gpointer data)
+{
+	for (guint i = 0; i < guest_count; i++) {
+		GtStats *stats;
+		char *text;
+
+		if (NULL == guests[i].loop) {
+			continue;
+		}
+
+		stats = gt_loop_get_stats(guests[i].loop);
+		text  = gt_stats_format(stats);
+
+		if (guest_count > 1) {
+			fprintf(stderr, "guest %s\n", guests[i].name);
+		}
+
+		fputs(text, stderr);
+
+		g_free(text);
+		gt_stats_free(stats);
+
+		if (NULL != guests[i].export) {
+			text = gt_export_format_stats(guests[i].export);
+			fputs(text, stderr);
+			g_free(text);
+		}
+	}
+
+	return G_SOURCE_CONTINUE;
+}
+
+/* Print and reset the counters of each guest; see gt_aggregate_flush(). */
+static gboolean
+gt_aggregate_handler(gpointer data)
+{
+	for (guint i = 0; i < guest_count; i++) {
+		if (NULL != guests[i].aggregate) {
+			gt_aggregate_flush(guests[i].aggregate);
+		}
+	}
+
+	return G_SOURCE_CONTINUE;
 }
 
 static int
@@ -61,13 +152,47 @@ done:
 static void
 usage()
 {
-	fprintf(stderr, "usage: guestrace [-i syscall1,syscall2] [-s] [-v] "
-	                "-n <VM name>\n"
+	fprintf(stderr, "usage: guestrace [-i syscall1,syscall2] [-s] [-r] [-v] "
+	                "[-f text|binary|json [-o <file>] [-C]] [-a <seconds> [-o <file>]] "
+	                "[-f binary|json -e <address> [-B]] "
+	                "[-u <socket>] [-k <dir>] [-x] [-S <sampling>] [-L <ms>] "
+	                "[-p pid1,pid2] [-c comm] -n <VM name> [-n <VM name> ...]\n"
+	                "       guestrace [options] -R <trace> [-R <trace> ...]\n"
 	                "\n"
 	                "-i  specify subset of system calls to instrument\n"
 	                "-s  operate in silent mode (no output on call/ret)\n"
+	                "-r  call-only mode (do not trace returns)\n"
+	                "-f  output format (default: text)\n"
+	                "-o  file to hold ring of binary records (with -f binary);\n"
+	                "    with several guests, <file>.<VM name> for each;\n"
+	                "    or file to hold JSON (with -f json; default: stdout)\n"
+	                "-a  count calls and time returns by process and system call, and\n"
+	                "    print a table every <seconds> to <file> (default: stdout)\n"
+	                "-e  stream events to a collector at <host>:<port> or unix:<path>\n"
+	                "    rather than writing them locally (with -f binary or -f json)\n"
+	                "-B  stall the guest when the collector falls behind, rather than\n"
+	                "    dropping events (with -e)\n"
+	                "-C  record the guest memory which decoding reads (with -f binary),\n"
+	                "    so that -R can decode the trace\n"
+	                "-u  accept enable/disable/remove/stats commands on UNIX socket\n"
+	                "-k  remember kernel layout in <dir>, to attach faster to guests\n"
+	                "    which run the same kernel\n"
+	                "-S  pass only a sample of calls to the output, as a comma-separated\n"
+	                "    list of every=<n>, rate=<calls/s per process>,\n"
+	                "    budget=<traps/s before disarming> and duty=<on ms>/<period ms>\n"
+	                "-x  let the guest read instrumented pages through an execute-only\n"
+	                "    view rather than single-stepping each read\n"
+	                "-L  on exit, keep servicing returns for up to <ms> before pausing\n"
+	                "    the guest to restore the stacks of calls still in flight\n"
+	                "-p  trace only the processes with the given PIDs\n"
+	                "-c  trace only processes whose name matches glob comm\n"
 	                "-v  verbose\n"
-	                "-n  name of guest to instrument\n");
+	                "-n  name of guest to instrument; repeat to trace several\n"
+	                "    guests at once, prefixing each line with the guest\n"
+	                "-R  replay a binary trace instead of instrumenting a guest;\n"
+	                "    repeat to replay several traces at once\n"
+	                "\n"
+	                "Send SIGUSR1 to print per-VCPU counters and timings to stderr.\n");
 }
 
 static int
@@ -95,106 +220,456 @@ void *silent_syscall(GtGuestState *state, gt_pid_t pid, gt_tid_t tid, void *user
 void silent_sysret(GtGuestState *state, gt_pid_t pid, gt_tid_t tid, void *user_data) {
 }
 
-static GtCallbackRegistry *
-registry_dup(const GtCallbackRegistry *registry)
+/*
+ * Build the filter described by the -p and -c options, or return NULL if
+ * neither option was given or pid_list is malformed.
+ */
+static GtFilter *
+filter_build(char *pid_list, const char *process_pattern)
 {
-	GtCallbackRegistry *copy;
-	int count = 0;
+	GtFilter *filter = NULL;
+	char *ptr, *token, *end;
 
-	while (NULL != registry[count].name) {
-		count++;
+	if (NULL == pid_list && NULL == process_pattern) {
+		goto done;
 	}
 
-	copy = g_new0(GtCallbackRegistry, count + 1);
+	filter = gt_filter_new();
+
+	if (NULL != pid_list) {
+		for (token = strtok_r(pid_list, ",", &ptr);
+		     NULL != token;
+		     token = strtok_r(NULL, ",", &ptr)) {
+			long pid = strtol(token, &end, 10);
+			if ('\0' != *end || pid < 0) {
+				gt_filter_unref(filter);
+				filter = NULL;
+				goto done;
+			}
 
-	for (int i = 0; i < count; i++) {
-		copy[i] = registry[i];
+			gt_filter_add_pid(filter, pid);
+		}
 	}
 
-	copy[count] = (GtCallbackRegistry) { NULL };
+	if (NULL != process_pattern) {
+		gt_filter_set_process_name(filter, process_pattern);
+	}
 
-	return copy;
+done:
+	return filter;
 }
 
-static GtCallbackRegistry *
-registry_build(const GtCallbackRegistry *registry, char *instrument_list)
+/*
+ * Fill in sampling from spec, a comma-separated list of every=<n>,
+ * rate=<calls per second>, budget=<calls per second> and
+ * duty=<on ms>/<period ms>. Returns FALSE if spec is malformed.
+ */
+static gboolean
+sampling_parse(char *spec, GtSampling *sampling)
 {
-	int i;
-	GtCallbackRegistry *new = NULL;
+	gboolean ok = FALSE;
+	char *ptr, *token, *end;
 
-	if (NULL == instrument_list) {
-		new = registry_dup(registry);
-	} else if (0 == strlen(instrument_list)) {
-		new = g_new0(GtCallbackRegistry, 1);
-		new[0] = (GtCallbackRegistry) { NULL };
-	} else {
-		int size, j;
-		char *ptr, *token;
+	memset(sampling, 0x00, sizeof *sampling);
 
-		size = 2; /* At least one syscall + NULL record. */
+	for (token = strtok_r(spec, ",", &ptr);
+	     NULL != token;
+	     token = strtok_r(NULL, ",", &ptr)) {
+		char *value = strchr(token, '=');
+		unsigned long number;
 
-		ptr = strchr(instrument_list, ',');
-		while (NULL != ptr) {
-			size++;
-			ptr = strchr(ptr + 1, ',');
+		if (NULL == value) {
+			goto done;
 		}
 
-		new = g_new0(GtCallbackRegistry, size);
+		*value++ = '\0';
+		number   = strtoul(value, &end, 10);
+
+		if (0 == strcmp(token, "every")) {
+			sampling->every = number;
+		} else if (0 == strcmp(token, "rate")) {
+			sampling->process_rate = number;
+		} else if (0 == strcmp(token, "budget")) {
+			sampling->budget = number;
+		} else if (0 == strcmp(token, "duty") && '/' == *end) {
+			sampling->duty_on_ms     = number;
+			sampling->duty_period_ms = strtoul(end + 1, &end, 10);
+			if (sampling->duty_on_ms > sampling->duty_period_ms) {
+				goto done;
+			}
+		} else {
+			goto done;
+		}
 
-		new[size - 1] = (GtCallbackRegistry) { NULL };
+		if (value == end || '\0' != *end) {
+			goto done;
+		}
+	}
 
-		token = strtok_r(instrument_list, ",", &ptr);
-		for (i = 0; i < size - 1; i++) {
-			for (j = 0; NULL != registry[j].name; j++) {
-				if (0 == strcmp(registry[j].name, token)) {
-					new[i] = registry[j];
-					break;
-				}
-			}
+	ok = TRUE;
 
-			if (NULL == new[j].name) {
-				g_free(new);
-				new = NULL;
-				goto done;
+done:
+	return ok;
+}
+
+/*
+ * Return the descriptions of the system calls which instrument_list names, or
+ * of every system call in syscalls if instrument_list is NULL. Returns NULL
+ * if instrument_list names a system call which syscalls does not describe.
+ */
+static GPtrArray *
+syscalls_select(const gt_syscall_desc *syscalls, char *instrument_list)
+{
+	GPtrArray *selected = g_ptr_array_new();
+	char *ptr, *token;
+
+	if (NULL == instrument_list) {
+		for (int i = 0; NULL != syscalls[i].name; i++) {
+			g_ptr_array_add(selected, (gpointer) &syscalls[i]);
+		}
+		goto done;
+	}
+
+	for (token = strtok_r(instrument_list, ",", &ptr);
+	     NULL != token;
+	     token = strtok_r(NULL, ",", &ptr)) {
+		const gt_syscall_desc *desc = NULL;
+
+		for (int i = 0; NULL != syscalls[i].name; i++) {
+			if (0 == strcmp(syscalls[i].name, token)) {
+				desc = &syscalls[i];
+				break;
 			}
+		}
+
+		if (NULL == desc) {
+			g_ptr_array_free(selected, TRUE);
+			selected = NULL;
+			goto done;
+		}
+
+		g_ptr_array_add(selected, (gpointer) desc);
+	}
+
+done:
+	return selected;
+}
 
-			token = strtok_r(NULL, ",", &ptr);
+/*
+ * Fill in the callbacks of guest's registry, which holds an entry for each
+ * system call in selected, with those the -s and -r options call for.
+ */
+static void
+registry_apply_options(struct guest *guest, GPtrArray *selected)
+{
+	for (guint i = 0; i < selected->len; i++) {
+		GtCallbackRegistry *entry = &guest->registry[i];
+
+		if (silent) {
+			entry->syscall_cb = silent_syscall;
+			entry->sysret_cb  = call_only ? NULL : silent_sysret;
+		} else if (NULL != guest->aggregate) {
+			gt_aggregate_hook_init(guest->aggregate, i, !call_only, entry);
+		} else {
+			gt_decode_hook_init(&guest->hooks[i],
+			                    guest->sink,
+			                    g_ptr_array_index(selected, i),
+			                    i,
+			                    !call_only,
+			                    entry);
 		}
 	}
+}
+
+/* Record the memory which decoding read, so that a replay can read it. */
+static void
+capture_memory(GtGuestState *state,
+               gt_addr_t vaddr,
+               const void *data,
+               gsize size,
+               void *user_data)
+{
+	gt_binary_trace_add_memory(user_data, vaddr, data, size);
+}
+
+/*
+ * Connect to the guest, and instrument the system calls which the command
+ * line calls for. Returns the number of system calls instrumented.
+ */
+static int
+guest_set_up(struct guest *guest, GtFilter *filter)
+{
+	int count = 0;
+	char *list = NULL;
+	GPtrArray *selected = NULL;
+	const gt_syscall_desc *syscalls;
+
+	message("creating event loop for %s\n", guest->name);
 
-	if (silent) {
-		for (i = 0; NULL != new[i].name; i++) {
-			new[i].syscall_cb = silent_syscall;
-			new[i].sysret_cb  = silent_sysret;
+	guest->loop = replay ? gt_replay_loop_new(guest->name) : gt_loop_new(guest->name);
+	if (NULL == guest->loop) {
+		fprintf(stderr, "could not initialize guestrace for %s\n", guest->name);
+		goto done;
+	}
+
+	if (NULL != cache_dir) {
+		gt_loop_set_attach_cache(guest->loop, cache_dir);
+	}
+
+	gt_loop_set_execute_only(guest->loop, execute_only);
+	gt_loop_set_lazy_detach(guest->loop, lazy_detach);
+
+	message("identifying OS type ... ");
+
+	GtOSType os = gt_loop_get_ostype(guest->loop);
+
+	switch (os) {
+	case GT_OS_LINUX:
+		syscalls = GT_LINUX_SYSCALLS;
+		break;
+	case GT_OS_WINDOWS:
+		syscalls = GT_WINDOWS_SYSCALLS;
+		break;
+	default:
+		fprintf(stderr, "unknown guest operating system\n");
+		goto done;
+	}
+
+	message("%s\n", GT_OS_LINUX == os ? "linux" : "windows");
+
+	/* syscalls_select() consumes the list, and each guest needs a copy. */
+	list = g_strdup(instrument_list);
+
+	selected = syscalls_select(syscalls, list);
+	if (NULL == selected) {
+		fprintf(stderr, "error building system call registry\n");
+		goto done;
+	}
+
+	guest->registry = g_new0(GtCallbackRegistry, selected->len + 1);
+	guest->hooks    = g_new0(gt_decode_hook, selected->len);
+
+	for (guint i = 0; i < selected->len; i++) {
+		const gt_syscall_desc *desc = g_ptr_array_index(selected, i);
+		guest->registry[i].name = (char *) desc->name;
+	}
+
+	if (0 != aggregate_interval) {
+		guest->aggregate = gt_aggregate_new(aggregate_out,
+		                                    guest_count > 1 ? guest->name : NULL,
+		                                    selected->len);
+	} else if (NULL != export_address) {
+		message("exporting events to %s\n", export_address);
+
+		guest->export = gt_export_open(export_address,
+		                               json ? GT_EXPORT_FRAME_JSON : GT_EXPORT_FRAME_BINARY,
+		                               export_block ? GT_EXPORT_POLICY_BLOCK
+		                                            : GT_EXPORT_POLICY_DROP,
+		                               0,
+		                               os,
+		                               guest->name,
+		                               guest->registry);
+		if (NULL == guest->export) {
+			fprintf(stderr, "could not open export\n");
+			goto done;
+		}
+
+		guest->sink = json
+		            ? gt_json_sink_new(gt_export_get_stream(guest->export),
+		                               guest_count > 1 ? guest->name : NULL)
+		            : gt_export_sink_new(guest->export);
+	} else if (binary) {
+		/* A replay's name is the path of its trace. */
+		char *base = g_path_get_basename(guest->name);
+		char *path = guest_count > 1
+		           ? g_strdup_printf("%s.%s", output_file, base)
+		           : g_strdup(output_file);
+
+		g_free(base);
+
+		message("creating binary trace %s\n", path);
+
+		guest->binary_trace = gt_binary_trace_open(path,
+		                                           GT_BINARY_TRACE_DEFAULT_CAPACITY,
+		                                           os,
+		                                           guest->registry);
+		g_free(path);
+		if (NULL == guest->binary_trace) {
+			fprintf(stderr, "could not create binary trace\n");
+			goto done;
+		}
+
+		guest->sink = gt_binary_sink_new(guest->binary_trace, capture);
+
+		if (capture) {
+			gt_loop_set_memory_cb(guest->loop, capture_memory, guest->binary_trace);
 		}
+	} else if (json) {
+		guest->sink = gt_json_sink_new(json_out, guest_count > 1 ? guest->name : NULL);
+	} else {
+		guest->sink = gt_text_sink_new(os, stderr, guest_count > 1 ? guest->name : NULL);
+	}
+
+	registry_apply_options(guest, selected);
+
+	if (NULL != filter) {
+		gt_loop_set_filter(guest->loop, filter);
+	}
+
+	message("establishing callbacks (might take a few seconds) ... ");
+
+	count = gt_loop_set_cbs(guest->loop, guest->registry);
+	if (0 == count) {
+		fprintf(stderr, "unable to instrument any system calls\n");
+		goto done;
+	}
+
+	message("%d system calls instrumented\n", count);
+
+	if (NULL != sampling_spec) {
+		gt_loop_set_sampling(guest->loop, NULL, &sampling);
 	}
 
 done:
-	return new;
+	g_free(list);
+
+	if (NULL != selected) {
+		g_ptr_array_free(selected, TRUE);
+	}
+
+	return count;
+}
+
+static void
+guest_free(struct guest *guest)
+{
+	gt_loop_free(guest->loop);
+	gt_sink_free(guest->sink);
+	gt_binary_trace_close(guest->binary_trace);
+
+	/* Report what the collector missed before sending what remains. */
+	if (NULL != guest->export) {
+		char *text = gt_export_format_stats(guest->export);
+
+		fputs(text, stderr);
+		g_free(text);
+
+		gt_export_close(guest->export);
+	}
+
+	/* Print the counters gathered since the last table. */
+	if (NULL != guest->aggregate) {
+		gt_aggregate_flush(guest->aggregate);
+		gt_aggregate_free(guest->aggregate);
+	}
+
+	g_free(guest->registry);
+	g_free(guest->hooks);
+}
+
+/* Stop the main loop once every guest's loop has stopped. */
+static gboolean
+guests_check(gpointer data)
+{
+	GMainLoop *main_loop = data;
+	gboolean running = FALSE;
+
+	for (guint i = 0; i < guest_count; i++) {
+		running |= gt_loop_is_running(guests[i].loop);
+	}
+
+	if (!running) {
+		g_main_loop_quit(main_loop);
+	}
+
+	return running;
 }
 
 int
 main (int argc, char **argv) {
-	int opt, count;
+	int opt;
 	struct sigaction act;
-	const GtCallbackRegistry *orig_registry;
-	GtCallbackRegistry *registry = NULL;
+	gt_control *control = NULL;
+	GtFilter *filter = NULL;
+	GtLoop **loops = NULL;
 	status_t status = VMI_FAILURE;
 
-	while ((opt = getopt(argc, argv, "hi:n:sv")) != -1) {
+	names = g_ptr_array_new();
+
+	while ((opt = getopt(argc, argv, "BL:a:Cc:e:f:hi:k:n:o:p:R:rS:su:vx")) != -1) {
 		switch (opt) {
+		case 'B':
+			export_block = TRUE;
+			break;
+		case 'L':
+			lazy_detach = atoi(optarg);
+			if (lazy_detach <= 0) {
+				usage();
+				goto done;
+			}
+			break;
+		case 'a':
+			aggregate_interval = atoi(optarg);
+			if (aggregate_interval <= 0) {
+				usage();
+				goto done;
+			}
+			break;
+		case 'C':
+			capture = TRUE;
+			break;
+		case 'c':
+			process_pattern = optarg;
+			break;
+		case 'e':
+			export_address = optarg;
+			break;
+		case 'f':
+			binary = 0 == strcmp(optarg, "binary");
+			json   = 0 == strcmp(optarg, "json");
+			if (!binary && !json && 0 != strcmp(optarg, "text")) {
+				usage();
+				goto done;
+			}
+			break;
 		case 'i':
 			instrument_list = optarg;
 			break;
+		case 'k':
+			cache_dir = optarg;
+			break;
+		case 'o':
+			output_file = optarg;
+			break;
+		case 'p':
+			pid_list = optarg;
+			break;
 		case 'n':
-			name = optarg;
+			g_ptr_array_add(names, optarg);
+			live = TRUE;
+			break;
+		case 'R':
+			g_ptr_array_add(names, optarg);
+			replay = TRUE;
+			break;
+		case 'r':
+			call_only = TRUE;
+			break;
+		case 'S':
+			sampling_spec = optarg;
 			break;
 		case 's':
 			silent = TRUE;
 			break;
+		case 'u':
+			control_path = optarg;
+			break;
 		case 'v':
 			verbose = TRUE;
 			break;
+		case 'x':
+			execute_only = TRUE;
+			break;
 		case 'h':
 		default:
 			usage();
@@ -202,7 +677,18 @@ main (int argc, char **argv) {
 		}
 	}
 
-	if (NULL == name) {
+	if (0 == names->len || (live && replay)) {
+		usage();
+		goto done;
+	}
+
+	/* Replays cost no exits, so there is nothing for sampling to save. */
+	if (NULL != sampling_spec && (replay || !sampling_parse(sampling_spec, &sampling))) {
+		usage();
+		goto done;
+	}
+
+	if (capture && !binary) {
 		usage();
 		goto done;
 	}
@@ -212,65 +698,135 @@ main (int argc, char **argv) {
 		goto done;
 	}
 
-	message("setting up signal handlers\n");
+	if (0 != aggregate_interval && (binary || json || silent)) {
+		usage();
+		goto done;
+	}
 
-	if (-1 == gt_set_up_signal_handler(act)) {
-		perror("failed to setup signal handler.\n");
+	if (NULL != export_address && ((!binary && !json) || NULL != output_file || capture)) {
+		usage();
 		goto done;
 	}
 
-	message("creating event loop\n");
+	if (export_block && NULL == export_address) {
+		usage();
+		goto done;
+	}
 
-	loop = gt_loop_new(name);
-	if (NULL == loop) {
-		fprintf(stderr, "could not initialize guestrace\n");
+	if (binary != (NULL != output_file) && !json && 0 == aggregate_interval
+	 && NULL == export_address) {
+		usage();
 		goto done;
 	}
 
-	message("identifying OS type ... ");
+	if (json && NULL == export_address) {
+		json_out = NULL == output_file ? stdout : fopen(output_file, "w");
+		if (NULL == json_out) {
+			perror("failed to open JSON output");
+			goto done;
+		}
+	}
 
-	GtOSType os = gt_loop_get_ostype(loop);
+	if (0 != aggregate_interval) {
+		aggregate_out = NULL == output_file ? stdout : fopen(output_file, "w");
+		if (NULL == aggregate_out) {
+			perror("failed to open aggregation output");
+			goto done;
+		}
+	}
 
-	switch (os) {
-	case GT_OS_LINUX:
-		orig_registry = GT_LINUX_SYSCALLS;
-		break;
-	case GT_OS_WINDOWS:
-		orig_registry = GT_WINDOWS_SYSCALLS;
-		break;
-	default:
-		fprintf(stderr, "unknown guest operating system\n");
-		goto done;
+	if (NULL != pid_list || NULL != process_pattern) {
+		filter = filter_build(pid_list, process_pattern);
+		if (NULL == filter) {
+			fprintf(stderr, "invalid PID list\n");
+			goto done;
+		}
 	}
 
-	message("%s\n", GT_OS_LINUX == os ? "linux" : "windows");
+	guest_count = names->len;
+	guests      = g_new0(struct guest, guest_count);
+	loops       = g_new0(GtLoop *, guest_count);
 
-	registry = registry_build(orig_registry, instrument_list);
-	if (NULL == registry) {
-		fprintf(stderr, "error building system call registry\n");
-		goto done;
+	for (guint i = 0; i < guest_count; i++) {
+		guests[i].name = g_ptr_array_index(names, i);
 	}
 
-	message("establishing callbacks (might take a few seconds) ... ");
+	message("setting up signal handlers\n");
 
-	count = gt_loop_set_cbs(loop, registry);
-	if (0 == count) {
-		fprintf(stderr, "unable to instrument any system calls\n");
+	if (-1 == gt_set_up_signal_handler(act)) {
+		perror("failed to setup signal handler.\n");
 		goto done;
 	}
 
-	message("%d system calls instrumented\n", count);
+	for (guint i = 0; i < guest_count; i++) {
+		if (0 == guest_set_up(&guests[i], filter)) {
+			goto done;
+		}
+
+		loops[i] = guests[i].loop;
+	}
+
+	if (NULL != control_path) {
+		message("listening for commands on %s\n", control_path);
+
+		control = gt_control_open(loops, guest_count, control_path);
+		if (NULL == control) {
+			fprintf(stderr, "could not open control socket\n");
+			goto done;
+		}
+	}
+
+	/* The default main context dispatches this, as it does the control socket. */
+	g_unix_signal_add(SIGUSR1, gt_stats_handler, NULL);
+
+	if (0 != aggregate_interval) {
+		g_timeout_add_seconds(aggregate_interval, gt_aggregate_handler, NULL);
+	}
 
 	message("running event loop ...\n");
 
 	status = VMI_SUCCESS;
-	gt_loop_run(loop);
+
+	if (1 == guest_count) {
+		gt_loop_run(guests[0].loop);
+	} else {
+		/* The main thread services the control socket. */
+		GMainLoop *main_loop = g_main_loop_new(NULL, true);
+
+		for (guint i = 0; i < guest_count; i++) {
+			gt_loop_start(guests[i].loop);
+		}
+
+		g_timeout_add(500, guests_check, main_loop);
+		g_main_loop_run(main_loop);
+		g_main_loop_unref(main_loop);
+
+		for (guint i = 0; i < guest_count; i++) {
+			gt_loop_join(guests[i].loop);
+		}
+	}
 
 done:
 	message("freeing event loop\n");
 
-	gt_loop_free(loop);
-	g_free(registry);
+	gt_control_close(control);
+	gt_filter_unref(filter);
+
+	for (guint i = 0; i < guest_count; i++) {
+		guest_free(&guests[i]);
+	}
+
+	if (NULL != json_out && stdout != json_out) {
+		fclose(json_out);
+	}
+
+	if (NULL != aggregate_out && stdout != aggregate_out) {
+		fclose(aggregate_out);
+	}
+
+	g_free(guests);
+	g_free(loops);
+	g_ptr_array_free(names, TRUE);
 
 	exit(VMI_SUCCESS == status ? EXIT_SUCCESS : EXIT_FAILURE);
 }
@@ -23,6 +23,29 @@ typedef struct _GtLoop GtLoop;
  */
 typedef struct _GtGuestState GtGuestState;
 
+/**
+ * GtArgs
+ *
+ * The `GtArgs` struct is an opaque data type representing the arguments of
+ * the system call which caused an event. Guestrace decodes each argument
+ * only when a callback asks for it; see gt_guest_get_args().
+ */
+typedef struct _GtArgs GtArgs;
+
+/**
+ * GtStringView:
+ * @data: the first character of the string, which is NUL-terminated.
+ * @length: the number of bytes in the string, excluding the terminator.
+ *
+ * A string in guest memory, read without making a copy for the caller.
+ * The view remains valid for the duration of the callback which obtained it;
+ * see gt_guest_get_string_view().
+ */
+typedef struct GtStringView {
+	const char *data;
+	gsize       length;
+} GtStringView;
+
 /**
  * gt_reg_name_t
  *
@@ -38,6 +61,18 @@ typedef int gt_reg_name_t;
  */
 typedef addr_t    gt_addr_t;
 
+/**
+ * GtArgsRange:
+ * @vaddr: a virtual address in the address space of the current process.
+ * @size: the number of bytes at @vaddr.
+ *
+ * Guest memory which a callback intends to read; see gt_args_capture().
+ */
+typedef struct GtArgsRange {
+	gt_addr_t vaddr;
+	gsize     size;
+} GtArgsRange;
+
 /**
  * gt_pid_t:
  *
@@ -102,11 +137,112 @@ typedef void (*GtSysretFunc) (GtGuestState *state,
                               gt_tid_t tid,
                               void *user_data);
 
+/**
+ * GT_SNAPSHOT_CAPTURE_SIZE:
+ *
+ * The maximum number of bytes a #GtCaptureFunc can copy into a
+ * #GtEventSnapshot.
+ */
+#define GT_SNAPSHOT_CAPTURE_SIZE 256
+
+/**
+ * GtEventSnapshot:
+ * @timestamp: the time, in microseconds since the Epoch, at which the
+ * guestrace event loop serviced the event.
+ * @pid: the ID of the process running when the event occurred.
+ * @tid: the unique ID of the thread running within the current process.
+ * @vcpu: the VCPU on which the event occurred.
+ * @regs: the guest's registers at the time of the event.
+ * @captured: the number of bytes of @capture which hold data.
+ * @capture: bytes which the #GtCaptureFunc copied out of the guest.
+ *
+ * A copy of the state of the guest at the time of a system call or return,
+ * provided to each #GtDeferredFunc.
+ */
+typedef struct GtEventSnapshot {
+	gint64          timestamp;
+	gt_pid_t        pid;
+	gt_tid_t        tid;
+	uint32_t        vcpu;
+	x86_registers_t regs;
+	size_t          captured;
+	uint8_t         capture[GT_SNAPSHOT_CAPTURE_SIZE];
+} GtEventSnapshot;
+
+/**
+ * GtCaptureFunc:
+ * @state: the state of the guest at the time of the system call.
+ * @pid: the ID of the process running when the event occurred.
+ * @tid: the unique ID of the thread running within the current process.
+ * @buffer: the buffer into which to copy guest data.
+ * @size: the size of @buffer.
+ * @user_data: the data passed to gt_loop_set_deferred_cb().
+ *
+ * Copies the guest memory a #GtDeferredFunc will later need, such as the
+ * string a system-call argument points to, into @buffer. The guestrace event
+ * loop invokes this callback while the guest VCPU remains paused, so it
+ * should read no more than necessary.
+ *
+ * Returns: the number of bytes copied into @buffer.
+ */
+typedef size_t (*GtCaptureFunc) (GtGuestState *state,
+                                 gt_pid_t pid,
+                                 gt_tid_t tid,
+                                 uint8_t *buffer,
+                                 size_t size,
+                                 void *user_data);
+
+/**
+ * GtDeferredFunc:
+ * @snapshot: a copy of the guest's state at the time of the event.
+ * @user_data: the data passed to gt_loop_set_deferred_cb().
+ *
+ * Specifies the type of functions passed to gt_loop_set_deferred_cb(). A
+ * worker thread invokes this callback some time after the guest has resumed,
+ * so it cannot access the guest; any guest memory it needs must come from
+ * @snapshot. A worker thread services the calls and returns of a given
+ * thread in order, but different workers might run concurrently.
+ */
+typedef void (*GtDeferredFunc) (const GtEventSnapshot *snapshot,
+                                void *user_data);
+
+/**
+ * GtMemoryFunc:
+ * @state: the state of the guest at the time of the event.
+ * @vaddr: the guest virtual address of the memory.
+ * @data: a copy of the memory.
+ * @size: the number of bytes at @data.
+ * @user_data: the data passed to gt_loop_set_memory_cb().
+ *
+ * Specifies the type of functions passed to gt_loop_set_memory_cb(). The
+ * guestrace event loop invokes this callback with each range of guest memory
+ * which a callback reads through a #GtArgs or a string helper such as
+ * gt_guest_get_string(), so that a capture can hold whatever a replay of the
+ * callback will read; see gt_replay_loop_new(). @data remains valid only
+ * until this callback returns.
+ */
+typedef void (*GtMemoryFunc) (GtGuestState *state,
+                              gt_addr_t vaddr,
+                              const void *data,
+                              gsize size,
+                              void *user_data);
+
+/**
+ * GtFilter:
+ *
+ * An opaque data structure which describes the system calls which the
+ * guestrace event loop should service, based on the calling process and on
+ * the call's arguments.
+ */
+typedef struct _GtFilter GtFilter;
+
 /**
  * GtCallbackRegistry
  * @name: the name of the kernel function to instrument.
  * @syscall_cb: the #GtSyscallFunc which the guestrace event loop will invoke upon @name being called.
- * @sysret_cb: the #GtSysretFunc which the guestrace event loop will invoke when @name returns.
+ * @sysret_cb: the #GtSysretFunc which the guestrace event loop will invoke when @name returns, or NULL; see gt_loop_set_cb().
+ * @user_data: optional data which the guestrace event loop will pass to @syscall_cb.
+ * @filter: an optional #GtFilter which restricts the calls to @name which invoke @syscall_cb.
  *
  * Full callback definition for use with gt_loop_set_cbs().
  */
@@ -116,6 +252,7 @@ typedef struct GtCallbackRegistry {
         GtSyscallFunc syscall_cb;
         GtSysretFunc  sysret_cb;
         void         *user_data;
+        GtFilter     *filter;
 } GtCallbackRegistry;
 
 /**
@@ -134,17 +271,216 @@ typedef enum GtOSType {
 	GT_OS_COUNT,
 } GtOSType;
 
+/**
+ * GT_HISTOGRAM_BUCKETS:
+ *
+ * The number of buckets in a #GtHistogram.
+ */
+#define GT_HISTOGRAM_BUCKETS 304
+
+/**
+ * GtHistogram:
+ * @count: the number of values recorded.
+ * @sum: the sum of the values recorded.
+ * @max: the largest value recorded.
+ * @buckets: the number of values recorded in each bucket.
+ *
+ * A histogram of durations in nanoseconds. Like an HDR histogram, it divides
+ * each power of two into eight buckets, so each bucket spans at most 12.5%
+ * of the values it holds; durations beyond about eighteen minutes share the
+ * last bucket. See gt_histogram_percentile().
+ */
+typedef struct GtHistogram {
+	guint64 count;
+	guint64 sum;
+	guint64 max;
+	guint64 buckets[GT_HISTOGRAM_BUCKETS];
+} GtHistogram;
+
+/**
+ * GtPhase:
+ * @GT_PHASE_LOOKUP: finding the breakpoint and, for a return, its state.
+ * @GT_PHASE_PID: mapping CR3 to a PID.
+ * @GT_PHASE_CALLBACK: running the filters and the #GtSyscallFunc or #GtSysretFunc.
+ * @GT_PHASE_STACK_WRITE: checking and overwriting a call's return address.
+ * @GT_PHASE_RIP_SET: directing the VCPU of a return to its original return point.
+ *
+ * The phases of servicing a breakpoint which #GtVcpuStats times.
+ */
+typedef enum GtPhase {
+	GT_PHASE_LOOKUP,
+	GT_PHASE_PID,
+	GT_PHASE_CALLBACK,
+	GT_PHASE_STACK_WRITE,
+	GT_PHASE_RIP_SET,
+	/* <private> */
+	GT_PHASE_COUNT,
+} GtPhase;
+
+/**
+ * GtVcpuStats:
+ * @calls: system calls which invoked a #GtSyscallFunc.
+ * @returns: system returns which invoked a #GtSysretFunc.
+ * @orphaned_returns: breakpoints on the shared trampoline which matched no
+ * call in flight.
+ * @reinjected: breakpoints which guestrace did not place, and so passed on
+ * to the guest.
+ * @mem_rw: reads and writes of shadowed pages, such as by Windows kernel
+ * patch protection.
+ * @single_steps: single steps over a breakpoint or a shadowed access.
+ * @phases: the time spent in each #GtPhase.
+ *
+ * Counters which a #GtLoop keeps for each VCPU.
+ */
+typedef struct GtVcpuStats {
+	guint64     calls;
+	guint64     returns;
+	guint64     orphaned_returns;
+	guint64     reinjected;
+	guint64     mem_rw;
+	guint64     single_steps;
+	GtHistogram phases[GT_PHASE_COUNT];
+} GtVcpuStats;
+
+/**
+ * GtSyscallStats:
+ * @id: the ID of the callback; see gt_guest_get_cb_id().
+ * @name: the kernel function which implements the system call.
+ * @calls: calls which invoked the #GtSyscallFunc.
+ * @returns: returns which invoked the #GtSysretFunc.
+ * @skipped: calls which guestrace trapped but its sampler did not pass to
+ * the callbacks; see gt_loop_set_sampling().
+ * @disarms: times the sampler removed the breakpoint.
+ *
+ * Counters which a #GtLoop keeps for each callback.
+ */
+typedef struct GtSyscallStats {
+	guint    id;
+	char    *name;
+	guint64  calls;
+	guint64  returns;
+	guint64  skipped;
+	guint64  disarms;
+} GtSyscallStats;
+
+/**
+ * GtPageStats:
+ * @frame: the guest frame number of a page which holds breakpoints.
+ * @mem_rw: reads and writes of the page which caused an exit.
+ * @single_steps: those of @mem_rw which guestrace single-stepped.
+ * @view_switches: those of @mem_rw which instead moved the VCPU to the
+ * execute-only mode's read view; see gt_loop_set_execute_only().
+ * @exec_returns: executions of the page which moved a VCPU back from the
+ * read view.
+ * @exits_avoided: single-step exits which the read view saved, less the
+ * exits of @exec_returns. Accesses from within the read view cause no exit,
+ * so guestrace cannot count them; they save two exits each on top of this.
+ *
+ * Counters which a #GtLoop keeps for each page which holds breakpoints.
+ */
+typedef struct GtPageStats {
+	gt_addr_t frame;
+	guint64   mem_rw;
+	guint64   single_steps;
+	guint64   view_switches;
+	guint64   exec_returns;
+	guint64   exits_avoided;
+} GtPageStats;
+
+/**
+ * GtSampling:
+ * @every: pass one call in @every to the callbacks; zero or one passes all.
+ * @process_rate: calls per second which each process may pass to the
+ * callbacks, in bursts of up to a second's worth; zero for no limit.
+ * @budget: calls per second which guestrace may trap, in bursts of up to a
+ * second's worth, before it disarms the breakpoint; zero for no limit.
+ * @duty_on_ms: milliseconds at the start of each @duty_period_ms during
+ * which the breakpoint is armed.
+ * @duty_period_ms: length of the duty cycle, or zero for no duty cycle.
+ *
+ * Limits on the calls which reach a callback; see gt_loop_set_sampling().
+ * The limits apply in turn: a call must fit the budget, then be the
+ * @every'th call, then fit its process's rate.
+ */
+typedef struct GtSampling {
+	guint every;
+	guint process_rate;
+	guint budget;
+	guint duty_on_ms;
+	guint duty_period_ms;
+} GtSampling;
+
+/**
+ * GtStats:
+ * @vcpu_count: the number of elements in @vcpus.
+ * @vcpus: the counters of each VCPU.
+ * @syscall_count: the number of elements in @syscalls.
+ * @syscalls: the counters of each callback registered at the time of the
+ * snapshot.
+ * @page_count: the number of elements in @pages.
+ * @pages: the counters of each page which held breakpoints at the time of
+ * the snapshot.
+ *
+ * A snapshot of the counters of a #GtLoop; see gt_loop_get_stats().
+ */
+typedef struct GtStats {
+	guint           vcpu_count;
+	GtVcpuStats    *vcpus;
+	guint           syscall_count;
+	GtSyscallStats *syscalls;
+	guint           page_count;
+	GtPageStats    *pages;
+} GtStats;
+
+GtFilter      *gt_filter_new(void);
+GtFilter      *gt_filter_ref(GtFilter *filter);
+void           gt_filter_unref(GtFilter *filter);
+void           gt_filter_add_pid(GtFilter *filter, gt_pid_t pid);
+void           gt_filter_add_cr3(GtFilter *filter, gt_addr_t cr3);
+void           gt_filter_set_process_name(GtFilter *filter, const char *pattern);
+void           gt_filter_add_register_mask(GtFilter *filter,
+                                           gt_reg_name_t reg,
+                                           gt_reg_t mask,
+                                           gt_reg_t value);
 GtLoop        *gt_loop_new(const char *guest_name);
+GtLoop        *gt_replay_loop_new(const char *trace_file);
 GtOSType       gt_loop_get_ostype(GtLoop *loop);
 const char    *gt_loop_get_guest_name(GtLoop *loop);
 vmi_instance_t gt_loop_get_vmi_instance(GtLoop *loop);
+void           gt_loop_begin_update(GtLoop *loop);
+void           gt_loop_commit_update(GtLoop *loop);
+void           gt_loop_abort_update(GtLoop *loop);
 gboolean       gt_loop_set_cb(GtLoop *loop,
                               const char *kernel_func,
                               GtSyscallFunc syscall_cb,
                               GtSysretFunc sysret_cb,
                               void *user_data);
+gboolean       gt_loop_remove_cb(GtLoop *loop, const char *kernel_func);
+gboolean       gt_loop_set_cb_enabled(GtLoop *loop,
+                                      const char *kernel_func,
+                                      gboolean enabled);
 int            gt_loop_set_cbs(GtLoop *loop,
                                const GtCallbackRegistry callbacks[]);
+void           gt_loop_set_filter(GtLoop *loop, GtFilter *filter);
+void           gt_loop_set_memory_cb(GtLoop *loop,
+                                     GtMemoryFunc memory_cb,
+                                     void *user_data);
+void           gt_loop_set_attach_cache(GtLoop *loop, const char *dir);
+void           gt_loop_set_execute_only(GtLoop *loop, gboolean enabled);
+void           gt_loop_set_lazy_detach(GtLoop *loop, guint timeout);
+gboolean       gt_loop_set_sampling(GtLoop *loop,
+                                    const char *kernel_func,
+                                    const GtSampling *sampling);
+gboolean       gt_loop_set_cb_filter(GtLoop *loop,
+                                     const char *kernel_func,
+                                     GtFilter *filter);
+gboolean       gt_loop_set_deferred_cb(GtLoop *loop,
+                                       const char *kernel_func,
+                                       GtCaptureFunc capture_cb,
+                                       GtDeferredFunc syscall_cb,
+                                       GtDeferredFunc sysret_cb,
+                                       void *user_data);
+void           gt_loop_set_deferred_workers(GtLoop *loop, guint workers);
 guint          gt_loop_add_watch(GIOChannel *channel,
                                  GIOCondition condition,
                                  GIOFunc func,
@@ -152,11 +488,38 @@ guint          gt_loop_add_watch(GIOChannel *channel,
 gt_reg_t       gt_guest_get_register(GtGuestState *state, gt_reg_name_t name);
 char          *gt_guest_get_string(GtGuestState *state, gt_addr_t vaddr, gt_pid_t pid);
 char         **gt_guest_get_argv(GtGuestState *state, gt_addr_t vaddr, gt_pid_t pid);
+gboolean       gt_guest_get_string_view(GtGuestState *state,
+                                        gt_addr_t vaddr,
+                                        gt_pid_t pid,
+                                        GtStringView *view);
+const GtStringView *gt_guest_get_argv_view(GtGuestState *state,
+                                           gt_addr_t vaddr,
+                                           gt_pid_t pid,
+                                           guint *count);
+const char    *gt_guest_get_process_name(GtGuestState *state, gt_pid_t pid);
 vmi_instance_t gt_guest_get_vmi_instance(GtGuestState *state);
 vmi_event_t   *gt_guest_get_vmi_event(GtGuestState *state);
+guint          gt_guest_get_cb_id(GtGuestState *state);
+const char    *gt_loop_get_cb_name(GtLoop *loop, guint id);
+guint          gt_loop_get_cb_count(GtLoop *loop);
+GtArgs        *gt_guest_get_args(GtGuestState *state);
+gt_reg_t       gt_args_get(GtArgs *args, guint index);
+gboolean       gt_args_read(GtArgs *args, gt_addr_t vaddr, void *buffer, gsize size);
+void           gt_args_capture(GtArgs *args, const GtArgsRange *ranges, guint count);
+char          *gt_args_read_string(GtArgs *args, gt_addr_t vaddr);
+char          *gt_args_read_unicode_string(GtArgs *args, gt_addr_t vaddr);
+char          *gt_args_get_string(GtArgs *args, guint index);
+char          *gt_args_get_unicode_string(GtArgs *args, guint index);
 void           gt_guest_free_syscall_state(GtGuestState *state, gt_tid_t thread_id);
 void           gt_loop_run(GtLoop *loop);
+void           gt_loop_start(GtLoop *loop);
+void           gt_loop_join(GtLoop *loop);
+gboolean       gt_loop_is_running(GtLoop *loop);
 void           gt_loop_quit(GtLoop *loop);
 void           gt_loop_free(GtLoop *loop);
+GtStats       *gt_loop_get_stats(GtLoop *loop);
+char          *gt_stats_format(const GtStats *stats);
+void           gt_stats_free(GtStats *stats);
+guint64        gt_histogram_percentile(const GtHistogram *histogram, double percentile);
 
 #endif
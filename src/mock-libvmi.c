@@ -0,0 +1,496 @@
+#include "config.h"
+
+#include <glib.h>
+#include <libvmi/libvmi.h>
+#include <libvmi/events.h>
+#include <libvmi/slat.h>
+#include <libxl_utils.h>
+#include <stdlib.h>
+#include <string.h>
+#include <xenctrl.h>
+
+#include "mock-libvmi.h"
+
+struct vmi_instance {
+	os_t        os;
+	uint8_t    *memory;    /* MOCK_VMI_MEMORY_SIZE bytes. */
+	GHashTable *registers; /* Register to value. */
+	GHashTable *symbols;   /* Name to virtual address. */
+	GHashTable *offsets;   /* Name to offset. */
+	unsigned    vcpus;
+	GHashTable *stepping;  /* VCPU to the step event stepping it. */
+};
+
+vmi_instance_t
+mock_vmi_new(os_t os)
+{
+	vmi_instance_t vmi = g_new0(struct vmi_instance, 1);
+
+	vmi->os        = os;
+	vmi->memory    = g_malloc0(MOCK_VMI_MEMORY_SIZE);
+	vmi->registers = g_hash_table_new_full(g_int64_hash, g_int64_equal, g_free, g_free);
+	vmi->symbols   = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+	vmi->offsets   = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+	vmi->vcpus     = 1;
+	vmi->stepping  = g_hash_table_new(NULL, NULL);
+
+	return vmi;
+}
+
+void
+mock_vmi_set_symbol(vmi_instance_t vmi, const char *symbol, addr_t va)
+{
+	g_hash_table_insert(vmi->symbols, g_strdup(symbol), GSIZE_TO_POINTER(va));
+}
+
+void
+mock_vmi_set_offset(vmi_instance_t vmi, const char *name, unsigned long offset)
+{
+	g_hash_table_insert(vmi->offsets, g_strdup(name), GSIZE_TO_POINTER(offset));
+}
+
+void
+mock_vmi_set_num_vcpus(vmi_instance_t vmi, unsigned vcpus)
+{
+	vmi->vcpus = vcpus;
+}
+
+vmi_event_t *
+mock_vmi_get_step_event(vmi_instance_t vmi, uint32_t vcpu)
+{
+	return g_hash_table_lookup(vmi->stepping, GUINT_TO_POINTER(vcpu));
+}
+
+/* Return the memory at pa, or NULL if size bytes from pa run past the end. */
+static uint8_t *
+mock_vmi_memory(vmi_instance_t vmi, addr_t pa, size_t size)
+{
+	if (pa >= MOCK_VMI_MEMORY_SIZE || size > MOCK_VMI_MEMORY_SIZE - pa) {
+		return NULL;
+	}
+
+	return vmi->memory + pa;
+}
+
+static addr_t
+mock_vmi_translate(addr_t va)
+{
+	return va & (MOCK_VMI_MEMORY_SIZE - 1);
+}
+
+status_t
+vmi_init(vmi_instance_t *vmi, uint32_t flags, const char *name)
+{
+	/* The mock guest exists only through mock_vmi_new(). */
+	return VMI_FAILURE;
+}
+
+status_t
+vmi_destroy(vmi_instance_t vmi)
+{
+	g_hash_table_destroy(vmi->stepping);
+	g_hash_table_destroy(vmi->offsets);
+	g_hash_table_destroy(vmi->symbols);
+	g_hash_table_destroy(vmi->registers);
+	g_free(vmi->memory);
+	g_free(vmi);
+
+	return VMI_SUCCESS;
+}
+
+status_t
+vmi_pause_vm(vmi_instance_t vmi)
+{
+	return VMI_SUCCESS;
+}
+
+status_t
+vmi_resume_vm(vmi_instance_t vmi)
+{
+	return VMI_SUCCESS;
+}
+
+os_t
+vmi_get_ostype(vmi_instance_t vmi)
+{
+	return vmi->os;
+}
+
+uint8_t
+vmi_get_address_width(vmi_instance_t vmi)
+{
+	return sizeof(uint64_t);
+}
+
+uint64_t
+vmi_get_memsize(vmi_instance_t vmi)
+{
+	return MOCK_VMI_MEMORY_SIZE;
+}
+
+unsigned int
+vmi_get_num_vcpus(vmi_instance_t vmi)
+{
+	return vmi->vcpus;
+}
+
+status_t
+vmi_get_vcpureg(vmi_instance_t vmi, reg_t *value, reg_t reg, unsigned long vcpu)
+{
+	reg_t *stored = g_hash_table_lookup(vmi->registers, &reg);
+
+	if (NULL == stored) {
+		return VMI_FAILURE;
+	}
+
+	*value = *stored;
+
+	return VMI_SUCCESS;
+}
+
+status_t
+vmi_set_vcpureg(vmi_instance_t vmi, reg_t value, reg_t reg, unsigned long vcpu)
+{
+	reg_t *stored = g_hash_table_lookup(vmi->registers, &reg);
+
+	if (NULL == stored) {
+		reg_t *key = g_new(reg_t, 1);
+
+		*key   = reg;
+		stored = g_new(reg_t, 1);
+		g_hash_table_insert(vmi->registers, key, stored);
+	}
+
+	*stored = value;
+
+	return VMI_SUCCESS;
+}
+
+addr_t
+vmi_translate_kv2p(vmi_instance_t vmi, addr_t va)
+{
+	return mock_vmi_translate(va);
+}
+
+addr_t
+vmi_pagetable_lookup(vmi_instance_t vmi, addr_t dtb, addr_t va)
+{
+	return mock_vmi_translate(va);
+}
+
+addr_t
+vmi_translate_ksym2v(vmi_instance_t vmi, const char *symbol)
+{
+	return (addr_t) GPOINTER_TO_SIZE(g_hash_table_lookup(vmi->symbols, symbol));
+}
+
+size_t
+vmi_read_pa(vmi_instance_t vmi, addr_t pa, void *buffer, size_t size)
+{
+	uint8_t *memory = mock_vmi_memory(vmi, pa, size);
+
+	if (NULL == memory) {
+		return 0;
+	}
+
+	memcpy(buffer, memory, size);
+
+	return size;
+}
+
+size_t
+vmi_write_pa(vmi_instance_t vmi, addr_t pa, void *buffer, size_t size)
+{
+	uint8_t *memory = mock_vmi_memory(vmi, pa, size);
+
+	if (NULL == memory) {
+		return 0;
+	}
+
+	memcpy(memory, buffer, size);
+
+	return size;
+}
+
+status_t
+vmi_read_8_pa(vmi_instance_t vmi, addr_t pa, uint8_t *value)
+{
+	return sizeof *value == vmi_read_pa(vmi, pa, value, sizeof *value) ? VMI_SUCCESS : VMI_FAILURE;
+}
+
+status_t
+vmi_write_8_pa(vmi_instance_t vmi, addr_t pa, uint8_t *value)
+{
+	return sizeof *value == vmi_write_pa(vmi, pa, value, sizeof *value) ? VMI_SUCCESS : VMI_FAILURE;
+}
+
+status_t
+vmi_read_64_pa(vmi_instance_t vmi, addr_t pa, uint64_t *value)
+{
+	return sizeof *value == vmi_read_pa(vmi, pa, value, sizeof *value) ? VMI_SUCCESS : VMI_FAILURE;
+}
+
+status_t
+vmi_write_64_pa(vmi_instance_t vmi, addr_t pa, uint64_t *value)
+{
+	return sizeof *value == vmi_write_pa(vmi, pa, value, sizeof *value) ? VMI_SUCCESS : VMI_FAILURE;
+}
+
+/* Read or write size bytes at va, as the _va functions of libvmi do. */
+static status_t
+mock_vmi_access_va(vmi_instance_t vmi, addr_t va, void *buffer, size_t size, gboolean write)
+{
+	addr_t pa = mock_vmi_translate(va);
+	size_t done;
+
+	if (0 == pa) {
+		return VMI_FAILURE;
+	}
+
+	done = write ? vmi_write_pa(vmi, pa, buffer, size) : vmi_read_pa(vmi, pa, buffer, size);
+
+	return size == done ? VMI_SUCCESS : VMI_FAILURE;
+}
+
+status_t
+vmi_read_32_va(vmi_instance_t vmi, addr_t va, vmi_pid_t pid, uint32_t *value)
+{
+	return mock_vmi_access_va(vmi, va, value, sizeof *value, FALSE);
+}
+
+status_t
+vmi_read_64_va(vmi_instance_t vmi, addr_t va, vmi_pid_t pid, uint64_t *value)
+{
+	return mock_vmi_access_va(vmi, va, value, sizeof *value, FALSE);
+}
+
+status_t
+vmi_write_64_va(vmi_instance_t vmi, addr_t va, vmi_pid_t pid, uint64_t *value)
+{
+	return mock_vmi_access_va(vmi, va, value, sizeof *value, TRUE);
+}
+
+status_t
+vmi_read_addr_va(vmi_instance_t vmi, addr_t va, vmi_pid_t pid, addr_t *value)
+{
+	return mock_vmi_access_va(vmi, va, value, sizeof *value, FALSE);
+}
+
+status_t
+vmi_read_addr_ksym(vmi_instance_t vmi, const char *symbol, addr_t *value)
+{
+	addr_t va = vmi_translate_ksym2v(vmi, symbol);
+
+	if (0 == va) {
+		return VMI_FAILURE;
+	}
+
+	return vmi_read_addr_va(vmi, va, 0, value);
+}
+
+/* Return a copy of the string at va, allocated with malloc() as libvmi does. */
+char *
+vmi_read_str_va(vmi_instance_t vmi, addr_t va, vmi_pid_t pid)
+{
+	addr_t pa = mock_vmi_translate(va);
+	size_t length;
+
+	if (0 == pa) {
+		return NULL;
+	}
+
+	length = strnlen((char *) vmi->memory + pa, MOCK_VMI_MEMORY_SIZE - pa);
+	if (length == MOCK_VMI_MEMORY_SIZE - pa) {
+		return NULL;
+	}
+
+	return strdup((char *) vmi->memory + pa);
+}
+
+uint64_t
+vmi_get_offset(vmi_instance_t vmi, const char *offset_name)
+{
+	return GPOINTER_TO_SIZE(g_hash_table_lookup(vmi->offsets, offset_name));
+}
+
+vmi_pid_t
+vmi_dtb_to_pid(vmi_instance_t vmi, addr_t dtb)
+{
+	return dtb >> 12;
+}
+
+addr_t
+vmi_pid_to_dtb(vmi_instance_t vmi, vmi_pid_t pid)
+{
+	return (addr_t) pid << 12;
+}
+
+void
+vmi_pidcache_flush(vmi_instance_t vmi)
+{
+}
+
+const char *
+vmi_get_linux_sysmap(vmi_instance_t vmi)
+{
+	return NULL;
+}
+
+const char *
+vmi_get_rekall_path(vmi_instance_t vmi)
+{
+	return NULL;
+}
+
+status_t
+vmi_register_event(vmi_instance_t vmi, vmi_event_t *event)
+{
+	return VMI_SUCCESS;
+}
+
+status_t
+vmi_clear_event(vmi_instance_t vmi, vmi_event_t *event, vmi_event_free_t free_routine)
+{
+	return VMI_SUCCESS;
+}
+
+status_t
+vmi_events_listen(vmi_instance_t vmi, uint32_t timeout)
+{
+	return VMI_SUCCESS;
+}
+
+#ifdef HAVE_VMI_EVENT_GET_FD
+int
+vmi_event_get_fd(vmi_instance_t vmi)
+{
+	return -1;
+}
+#endif
+
+status_t
+vmi_set_mem_event(vmi_instance_t vmi, addr_t gfn, vmi_mem_access_t access, uint16_t slat_id)
+{
+	return VMI_SUCCESS;
+}
+
+status_t
+vmi_toggle_single_step_vcpu(vmi_instance_t vmi, vmi_event_t *event, uint32_t vcpu, bool enabled)
+{
+	if (VMI_EVENT_SINGLESTEP != event->type || vcpu >= vmi->vcpus) {
+		return VMI_FAILURE;
+	}
+
+	if (enabled) {
+		g_hash_table_insert(vmi->stepping, GUINT_TO_POINTER(vcpu), event);
+	} else {
+		g_hash_table_remove(vmi->stepping, GUINT_TO_POINTER(vcpu));
+	}
+
+	return VMI_SUCCESS;
+}
+
+status_t
+vmi_slat_set_domain_state(vmi_instance_t vmi, bool enabled)
+{
+	return VMI_SUCCESS;
+}
+
+status_t
+vmi_slat_create(vmi_instance_t vmi, uint16_t *slat_id)
+{
+	*slat_id = 1;
+
+	return VMI_SUCCESS;
+}
+
+status_t
+vmi_slat_destroy(vmi_instance_t vmi, uint16_t slat_id)
+{
+	return VMI_SUCCESS;
+}
+
+status_t
+vmi_slat_switch(vmi_instance_t vmi, uint16_t slat_id)
+{
+	return VMI_SUCCESS;
+}
+
+status_t
+vmi_slat_change_gfn(vmi_instance_t vmi, uint16_t slat_id, addr_t old_gfn, addr_t new_gfn)
+{
+	return VMI_SUCCESS;
+}
+
+/*
+ * The Xen calls. A loop which the mock backs has no Xen interface or libxl
+ * context, so these need only let gt_loop_free() run.
+ */
+
+xc_interface *
+xc_interface_open(xentoollog_logger *logger, xentoollog_logger *dombuild_logger, unsigned open_flags)
+{
+	return NULL;
+}
+
+int
+xc_interface_close(xc_interface *xch)
+{
+	return 0;
+}
+
+int
+xc_domain_setmaxmem(xc_interface *xch, uint32_t domid, uint64_t max_memkb)
+{
+	return 0;
+}
+
+int
+xc_domain_increase_reservation_exact(xc_interface *xch,
+                                     uint32_t domid,
+                                     unsigned long nr_extents,
+                                     unsigned int extent_order,
+                                     unsigned int mem_flags,
+                                     xen_pfn_t *extent_start)
+{
+	return -1;
+}
+
+int
+xc_domain_decrease_reservation_exact(xc_interface *xch,
+                                     uint32_t domid,
+                                     unsigned long nr_extents,
+                                     unsigned int extent_order,
+                                     xen_pfn_t *extent_start)
+{
+	return 0;
+}
+
+int
+xc_domain_populate_physmap_exact(xc_interface *xch,
+                                 uint32_t domid,
+                                 unsigned long nr_extents,
+                                 unsigned int extent_order,
+                                 unsigned int mem_flags,
+                                 xen_pfn_t *extent_start)
+{
+	return -1;
+}
+
+int
+libxl_ctx_alloc(libxl_ctx **pctx, int version, unsigned flags, xentoollog_logger *lg)
+{
+	return -1;
+}
+
+int
+libxl_ctx_free(libxl_ctx *ctx)
+{
+	return 0;
+}
+
+int
+libxl_name_to_domid(libxl_ctx *ctx, const char *name, uint32_t *domid)
+{
+	return -1;
+}
@@ -0,0 +1,31 @@
+#ifndef MOCK_LIBVMI_H
+#define MOCK_LIBVMI_H
+
+#include <libvmi/libvmi.h>
+
+/*
+ * A mock of the libvmi and Xen calls which libguestrace makes, so that
+ * bench-hot-path can drive guestrace's event handling without a Xen host.
+ *
+ * The mock guest has MOCK_VMI_MEMORY_SIZE bytes of physical memory, which
+ * every address space maps at each virtual address modulo that size; thus
+ * an address whose low bits are zero does not translate. Its registers,
+ * shared by every VCPU, hold what vmi_set_vcpureg() last stored; the
+ * process with DTB d has PID d >> 12; and its kernel symbols and structure
+ * offsets are those which mock_vmi_set_symbol() and mock_vmi_set_offset()
+ * define. It has one VCPU unless mock_vmi_set_num_vcpus() says otherwise,
+ * and mock_vmi_get_step_event() reports which event, if any,
+ * vmi_toggle_single_step_vcpu() left stepping a VCPU. Calls which would
+ * change the guest's configuration, such as vmi_slat_create(), succeed and
+ * do nothing.
+ */
+
+#define MOCK_VMI_MEMORY_SIZE (4 * 1024 * 1024)
+
+vmi_instance_t mock_vmi_new(os_t os);
+void           mock_vmi_set_symbol(vmi_instance_t vmi, const char *symbol, addr_t va);
+void           mock_vmi_set_offset(vmi_instance_t vmi, const char *name, unsigned long offset);
+void           mock_vmi_set_num_vcpus(vmi_instance_t vmi, unsigned vcpus);
+vmi_event_t   *mock_vmi_get_step_event(vmi_instance_t vmi, uint32_t vcpu);
+
+#endif
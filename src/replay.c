@@ -0,0 +1,595 @@
+#include <fcntl.h>
+#include <glib.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "binary-trace.h"
+#include "deferred.h"
+#include "filter.h"
+#include "functions-linux.h"
+#include "functions-windows.h"
+#include "replay.h"
+
+/*
+ * A replay loop drives the callbacks of an application from a binary trace
+ * rather than from a guest. It walks the records of the trace oldest first
+ * and invokes the callbacks registered on each record's system call, just
+ * as the live event loop would. Each GtGuestState carries a vmi_event_t
+ * whose registers hold what the trace recorded: the arguments, placed in
+ * the registers of the guest's calling convention, the stack pointer, and
+ * on return the return value. Memory reads through GtArgs and the string
+ * helpers find only the memory which the trace captured for the event;
+ * see gt_loop_set_memory_cb(). A trace records neither CR3 nor process
+ * names, so filters on either reject every event.
+ *
+ * Nothing but the trace file backs a replay loop, so several may run at
+ * once on different traces, or shards of one, each on its own thread.
+ */
+
+/* An arbitrary DTB; a trace captures the memory of one address space. */
+#define GT_REPLAY_DTB GT_PAGE_SIZE
+
+/* Callbacks registered for a system call; see gt_replay_set_cb(). */
+typedef struct gt_replay_cb {
+	guint         id;       /* See gt_guest_get_cb_id(). */
+	GtSyscallFunc syscall_cb;
+	GtSysretFunc  sysret_cb;
+	void         *user_data;
+	GtFilter     *filter;
+	gboolean      enabled;
+} gt_replay_cb;
+
+/* A call awaiting its return, as gt_syscall_state is for a live loop. */
+typedef struct gt_replay_call {
+	guint         id;
+	GtSysretFunc  sysret_cb;
+	void         *data;
+} gt_replay_call;
+
+/* A range of captured memory; its bytes start at offset in memory. */
+typedef struct gt_replay_chunk {
+	gt_addr_t va;
+	gsize     offset;
+	gsize     size;
+} gt_replay_chunk;
+
+struct gt_replay {
+	void                         *map;
+	size_t                        map_size;
+	const gt_binary_trace_header *header;
+	const gt_binary_record       *records;
+	const char                  **names;  /* header->name_count entries. */
+
+	GHashTable                   *cbs;    /* Name to gt_replay_cb. */
+	GHashTable                   *calls;  /* Thread ID to gt_replay_call. */
+
+	/* The memory captured for the next event. */
+	GArray                       *chunks;
+	GByteArray                   *memory;
+};
+
+static void
+gt_replay_cb_free(gpointer data)
+{
+	gt_replay_cb *cb = data;
+
+	gt_filter_unref(cb->filter);
+	g_free(cb);
+}
+
+/* Map the trace at path and check that its header describes the file. */
+static gboolean
+gt_replay_map(struct gt_replay *replay, const char *path)
+{
+	gboolean ok = FALSE;
+	int fd;
+	struct stat st;
+	const gt_binary_trace_header *header;
+	const char *names, *end;
+
+	fd = open(path, O_RDONLY);
+	if (-1 == fd) {
+		perror("failed to open trace");
+		goto done;
+	}
+
+	if (-1 == fstat(fd, &st)) {
+		perror("failed to stat trace");
+		goto done;
+	}
+
+	if ((size_t) st.st_size < sizeof *header) {
+		fprintf(stderr, "%s is not a guestrace binary trace\n", path);
+		goto done;
+	}
+
+	replay->map_size = st.st_size;
+	replay->map      = mmap(NULL, replay->map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (MAP_FAILED == replay->map) {
+		perror("failed to map trace");
+		replay->map = NULL;
+		goto done;
+	}
+
+	header = replay->header = replay->map;
+
+	if (0 != memcmp(header->magic, GT_BINARY_TRACE_MAGIC, sizeof header->magic)) {
+		fprintf(stderr, "%s is not a guestrace binary trace\n", path);
+		goto done;
+	}
+
+	if (GT_BINARY_TRACE_VERSION != header->version
+	 || sizeof(gt_binary_record) != header->record_size) {
+		fprintf(stderr, "unsupported trace version %u\n", header->version);
+		goto done;
+	}
+
+	if (header->names_offset + header->names_size > replay->map_size
+	 || header->records_offset > replay->map_size
+	 || header->capacity > (replay->map_size - header->records_offset)
+	                       / sizeof(gt_binary_record)) {
+		fprintf(stderr, "%s is truncated\n", path);
+		goto done;
+	}
+
+	replay->records = (const gt_binary_record *) ((const char *) replay->map
+	                                              + header->records_offset);
+	replay->names   = g_new0(const char *, header->name_count);
+
+	names = (const char *) replay->map + header->names_offset;
+	end   = names + header->names_size;
+
+	for (uint32_t i = 0; i < header->name_count; i++) {
+		const char *nul = memchr(names, '\0', end - names);
+
+		if (NULL == nul) {
+			fprintf(stderr, "%s has a corrupt name table\n", path);
+			goto done;
+		}
+
+		replay->names[i] = names;
+		names = nul + 1;
+	}
+
+	ok = TRUE;
+
+done:
+	if (-1 != fd) {
+		close(fd);
+	}
+
+	return ok;
+}
+
+/**
+ * gt_replay_loop_new:
+ * @trace_file: the path of a binary trace, which "guestrace -f binary"
+ * writes; see binary-trace.h.
+ *
+ * Creates a loop which invokes its callbacks on the events in @trace_file
+ * rather than on those of a live guest. The loop supports the API of a live
+ * #GtLoop: gt_loop_set_cb() and its relatives register callbacks by the
+ * names the trace records, gt_loop_run() or gt_loop_start() replays the
+ * trace, and gt_guest_get_register(), #GtArgs and the string helpers serve
+ * the callbacks from the trace. Memory reads succeed only if the trace
+ * captured the memory, as "guestrace -f binary -C" does for the memory
+ * guestrace's own decoder reads. gt_loop_get_vmi_instance() returns NULL.
+ * The loop finishes once it has replayed every record. @trace_file serves as
+ * the loop's guest name, and it must remain valid until gt_loop_free().
+ *
+ * Returns: a new #GtLoop, or NULL on error.
+ */
+GtLoop *
+gt_replay_loop_new(const char *trace_file)
+{
+	gboolean ok = FALSE;
+	GtLoop *loop = _gt_loop_alloc(trace_file);
+	struct gt_replay *replay = g_new0(struct gt_replay, 1);
+
+	loop->replay      = replay;
+	replay->cbs       = g_hash_table_new_full(g_str_hash,
+	                                          g_str_equal,
+	                                          g_free,
+	                                          gt_replay_cb_free);
+	replay->calls     = g_hash_table_new_full(NULL, NULL, NULL, g_free);
+	replay->chunks    = g_array_new(FALSE, FALSE, sizeof(gt_replay_chunk));
+	replay->memory    = g_byte_array_new();
+
+	if (-1 == loop->quit_pipe[0] || !gt_replay_map(replay, trace_file)) {
+		goto done;
+	}
+
+	switch (replay->header->os) {
+	case GT_OS_LINUX:
+		loop->os           = VMI_OS_LINUX;
+		loop->os_functions = &os_functions_linux;
+		break;
+	case GT_OS_WINDOWS:
+		loop->os           = VMI_OS_WINDOWS;
+		loop->os_functions = &os_functions_windows;
+		break;
+	default:
+		fprintf(stderr, "unknown guest operating system\n");
+		goto done;
+	}
+
+	loop->return_addr_width = sizeof(uint64_t);
+
+	ok = TRUE;
+
+done:
+	if (!ok) {
+		gt_loop_free(loop);
+		loop = NULL;
+	}
+
+	return loop;
+}
+
+/* Return the callbacks on kernel_func, creating them if create. */
+static gt_replay_cb *
+gt_replay_cb_lookup(GtLoop *loop, const char *kernel_func, gboolean create)
+{
+	struct gt_replay *replay = loop->replay;
+	gt_replay_cb *cb = g_hash_table_lookup(replay->cbs, kernel_func);
+
+	if (NULL == cb && create) {
+		cb     = g_new0(gt_replay_cb, 1);
+		cb->id = _gt_loop_cb_id(loop, kernel_func);
+		g_hash_table_insert(replay->cbs, g_strdup(kernel_func), cb);
+	}
+
+	return cb;
+}
+
+/* Like gt_loop_set_cb(), but also set filter if it is not NULL; see gt_loop_set_cbs(). */
+gboolean
+gt_replay_set_cb(GtLoop *loop,
+                 const char *kernel_func,
+                 GtSyscallFunc syscall_cb,
+                 GtSysretFunc sysret_cb,
+                 void *user_data,
+                 GtFilter *filter)
+{
+	struct gt_replay *replay = loop->replay;
+	gboolean ok = FALSE;
+	gt_replay_cb *cb;
+
+	g_rec_mutex_lock(&loop->lock);
+
+	/* As a live loop fails to resolve a symbol, fail on a name not traced. */
+	for (uint32_t i = 0; i < replay->header->name_count; i++) {
+		if (0 == strcmp(kernel_func, replay->names[i])) {
+			ok = TRUE;
+			break;
+		}
+	}
+
+	if (!ok) {
+		goto done;
+	}
+
+	cb = gt_replay_cb_lookup(loop, kernel_func, TRUE);
+	cb->syscall_cb = syscall_cb;
+	cb->sysret_cb  = sysret_cb;
+	cb->user_data  = user_data;
+	cb->enabled    = TRUE;
+
+	if (NULL != filter) {
+		gt_filter_unref(cb->filter);
+		cb->filter = gt_filter_ref(filter);
+	}
+
+done:
+	g_rec_mutex_unlock(&loop->lock);
+
+	return ok;
+}
+
+gboolean
+gt_replay_remove_cb(GtLoop *loop, const char *kernel_func)
+{
+	gboolean ok;
+
+	g_rec_mutex_lock(&loop->lock);
+	ok = g_hash_table_remove(loop->replay->cbs, kernel_func);
+	g_rec_mutex_unlock(&loop->lock);
+
+	return ok;
+}
+
+gboolean
+gt_replay_set_cb_enabled(GtLoop *loop, const char *kernel_func, gboolean enabled)
+{
+	gt_replay_cb *cb;
+
+	g_rec_mutex_lock(&loop->lock);
+
+	cb = gt_replay_cb_lookup(loop, kernel_func, FALSE);
+	if (NULL != cb) {
+		cb->enabled = enabled;
+	}
+
+	g_rec_mutex_unlock(&loop->lock);
+
+	return NULL != cb;
+}
+
+gboolean
+gt_replay_set_cb_filter(GtLoop *loop, const char *kernel_func, GtFilter *filter)
+{
+	gt_replay_cb *cb;
+
+	g_rec_mutex_lock(&loop->lock);
+
+	cb = gt_replay_cb_lookup(loop, kernel_func, FALSE);
+	if (NULL != cb) {
+		gt_filter_unref(cb->filter);
+		cb->filter = NULL == filter ? NULL : gt_filter_ref(filter);
+	}
+
+	g_rec_mutex_unlock(&loop->lock);
+
+	return NULL != cb;
+}
+
+void
+gt_replay_free_syscall_state(GtLoop *loop, gt_tid_t thread_id)
+{
+	g_hash_table_remove(loop->replay->calls, GSIZE_TO_POINTER(thread_id));
+}
+
+/* Add the memory in record to that of the next event. */
+static void
+gt_replay_add_memory(struct gt_replay *replay, const gt_binary_record *record)
+{
+	gsize size = MIN(record->size, sizeof record->args);
+	gt_replay_chunk *last = NULL;
+
+	if (replay->chunks->len > 0) {
+		last = &g_array_index(replay->chunks, gt_replay_chunk, replay->chunks->len - 1);
+	}
+
+	if (NULL != last && last->va + last->size == record->retval) {
+		last->size += size;
+	} else {
+		gt_replay_chunk chunk = { record->retval, replay->memory->len, size };
+		g_array_append_val(replay->chunks, chunk);
+	}
+
+	g_byte_array_append(replay->memory, (const guint8 *) record->args, size);
+}
+
+/* Return the chunk which holds vaddr, preferring the most recent. */
+static const gt_replay_chunk *
+gt_replay_find(struct gt_replay *replay, gt_addr_t vaddr)
+{
+	for (guint i = replay->chunks->len; i > 0; i--) {
+		const gt_replay_chunk *chunk = &g_array_index(replay->chunks,
+		                                              gt_replay_chunk,
+		                                              i - 1);
+
+		if (vaddr >= chunk->va && vaddr - chunk->va < chunk->size) {
+			return chunk;
+		}
+	}
+
+	return NULL;
+}
+
+/* Like gt_args_read(), but read the memory which the trace captured. */
+gboolean
+gt_replay_read(GtArgs *args, gt_addr_t vaddr, void *buffer, gsize size)
+{
+	struct gt_replay *replay = args->state->loop->replay;
+	gboolean ok = FALSE;
+	uint8_t *out = buffer;
+
+	while (size > 0) {
+		const gt_replay_chunk *chunk = gt_replay_find(replay, vaddr);
+		gsize offset, count;
+
+		if (NULL == chunk) {
+			goto done;
+		}
+
+		offset = vaddr - chunk->va;
+		count  = MIN(size, chunk->size - offset);
+
+		memcpy(out, replay->memory->data + chunk->offset + offset, count);
+
+		out   += count;
+		vaddr += count;
+		size  -= count;
+	}
+
+	ok = TRUE;
+
+done:
+	return ok;
+}
+
+/*
+ * Point view at the captured string at vaddr. The view remains valid until
+ * the next event, since guestrace appends no memory during an event.
+ */
+gboolean
+gt_replay_view_string(GtArgs *args, gt_addr_t vaddr, GtStringView *view)
+{
+	struct gt_replay *replay = args->state->loop->replay;
+	gboolean ok = FALSE;
+	const gt_replay_chunk *chunk = gt_replay_find(replay, vaddr);
+	const char *start, *end;
+	gsize offset;
+
+	if (NULL == chunk) {
+		goto done;
+	}
+
+	offset = vaddr - chunk->va;
+	start  = (const char *) replay->memory->data + chunk->offset + offset;
+	end    = memchr(start, '\0', chunk->size - offset);
+
+	/* The capture truncated the string. */
+	if (NULL == end) {
+		goto done;
+	}
+
+	*view = (GtStringView) { start, end - start };
+	ok = TRUE;
+
+done:
+	return ok;
+}
+
+/* Recreate the registers of the event which record describes. */
+static void
+gt_replay_fill_regs(GtLoop *loop, const gt_binary_record *record, x86_registers_t *regs)
+{
+	memset(regs, 0x00, sizeof *regs);
+
+	regs->rsp = record->tid;
+	regs->cr3 = GT_REPLAY_DTB;
+
+	if (GT_BINARY_RECORD_RETURN == record->type) {
+		regs->rax = record->retval;
+		return;
+	}
+
+	if (VMI_OS_LINUX == loop->os) {
+		regs->rdi = record->args[0];
+		regs->rsi = record->args[1];
+		regs->rdx = record->args[2];
+		regs->r10 = record->args[3];
+		regs->r8  = record->args[4];
+		regs->r9  = record->args[5];
+	} else {
+		/* The remaining arguments are on the stack, and so in memory. */
+		regs->rcx = regs->r10 = record->args[0];
+		regs->rdx = record->args[1];
+		regs->r8  = record->args[2];
+		regs->r9  = record->args[3];
+	}
+}
+
+/* Invoke the callbacks for the call or return which record describes. */
+static void
+gt_replay_event(GtLoop *loop, const gt_binary_record *record)
+{
+	struct gt_replay *replay = loop->replay;
+	x86_registers_t regs;
+	vmi_event_t event = { .x86_regs = &regs, .vcpu_id = record->vcpu };
+	GtGuestState state = { loop, NULL, &event };
+	GtVcpuStats *stats = _gt_loop_get_vcpu_stats(loop, record->vcpu);
+	gpointer tid = GSIZE_TO_POINTER(record->tid);
+
+	gt_replay_fill_regs(loop, record, &regs);
+
+	if (GT_BINARY_RECORD_CALL == record->type) {
+		gt_replay_cb *cb = NULL;
+		void *data;
+
+		if (record->syscall < replay->header->name_count) {
+			cb = g_hash_table_lookup(replay->cbs, replay->names[record->syscall]);
+		}
+
+		if (NULL == cb || !cb->enabled
+		 || !gt_filter_match(loop->filter, &state, record->pid)
+		 || !gt_filter_match(cb->filter, &state, record->pid)) {
+			goto done;
+		}
+
+		state.cb_id = cb->id;
+		data = cb->syscall_cb(&state, record->pid, record->tid, cb->user_data);
+		stats->calls++;
+
+		if (NULL != cb->sysret_cb) {
+			gt_replay_call *call = g_new(gt_replay_call, 1);
+
+			call->id        = cb->id;
+			call->sysret_cb = cb->sysret_cb;
+			call->data      = data;
+
+			g_hash_table_replace(replay->calls, tid, call);
+		}
+	} else {
+		gt_replay_call *call = g_hash_table_lookup(replay->calls, tid);
+
+		if (NULL == call) {
+			stats->orphaned_returns++;
+			goto done;
+		}
+
+		state.cb_id = call->id;
+		call->sysret_cb(&state, record->pid, record->tid, call->data);
+		stats->returns++;
+
+		g_hash_table_remove(replay->calls, tid);
+	}
+
+done:
+	g_array_set_size(replay->chunks, 0);
+	g_byte_array_set_size(replay->memory, 0);
+}
+
+/* Replay each record which remains in the ring, oldest first. */
+void
+gt_replay_run(GtLoop *loop)
+{
+	struct gt_replay *replay = loop->replay;
+	uint64_t capacity = replay->header->capacity;
+	uint64_t head     = __atomic_load_n(&replay->header->head, __ATOMIC_ACQUIRE);
+	uint64_t first    = head > capacity ? head - capacity : 0;
+
+	gt_deferred_start(loop);
+
+	for (uint64_t i = first; i < head && g_atomic_int_get(&loop->running); i++) {
+		const gt_binary_record *record = &replay->records[i % capacity];
+
+		/* Let other threads update the loop between events. */
+		g_rec_mutex_lock(&loop->lock);
+
+		switch (record->type) {
+		case GT_BINARY_RECORD_MEMORY:
+			gt_replay_add_memory(replay, record);
+			break;
+		case GT_BINARY_RECORD_CALL:
+		case GT_BINARY_RECORD_RETURN:
+			gt_replay_event(loop, record);
+			break;
+		default:
+			break;
+		}
+
+		g_rec_mutex_unlock(&loop->lock);
+	}
+
+	g_atomic_int_set(&loop->running, FALSE);
+
+	gt_deferred_stop(loop);
+
+	/* As a live loop does, forget the calls which never returned. */
+	g_hash_table_remove_all(replay->calls);
+}
+
+void
+gt_replay_free(GtLoop *loop)
+{
+	struct gt_replay *replay = loop->replay;
+
+	g_hash_table_destroy(replay->cbs);
+	g_hash_table_destroy(replay->calls);
+	g_array_free(replay->chunks, TRUE);
+	g_byte_array_free(replay->memory, TRUE);
+	g_free(replay->names);
+
+	if (NULL != replay->map) {
+		munmap(replay->map, replay->map_size);
+	}
+
+	g_free(replay);
+	loop->replay = NULL;
+}
@@ -0,0 +1,23 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "guestrace.h"
+#include "guestrace-private.h"
+
+gboolean gt_replay_set_cb(GtLoop *loop,
+                          const char *kernel_func,
+                          GtSyscallFunc syscall_cb,
+                          GtSysretFunc sysret_cb,
+                          void *user_data,
+                          GtFilter *filter);
+gboolean gt_replay_remove_cb(GtLoop *loop, const char *kernel_func);
+gboolean gt_replay_set_cb_enabled(GtLoop *loop, const char *kernel_func, gboolean enabled);
+gboolean gt_replay_set_cb_filter(GtLoop *loop, const char *kernel_func, GtFilter *filter);
+void     gt_replay_free_syscall_state(GtLoop *loop, gt_tid_t thread_id);
+void     gt_replay_run(GtLoop *loop);
+void     gt_replay_free(GtLoop *loop);
+
+gboolean gt_replay_read(GtArgs *args, gt_addr_t vaddr, void *buffer, gsize size);
+gboolean gt_replay_view_string(GtArgs *args, gt_addr_t vaddr, GtStringView *view);
+
+#endif
@@ -0,0 +1,182 @@
+#include <glib.h>
+
+#include "sampling.h"
+
+/*
+ * A sampler decides which calls of one kernel function reach the callbacks;
+ * see gt_loop_set_sampling(). Every call which the breakpoint traps passes
+ * through gt_sampler_admit(), which applies, in turn, the hook's budget of
+ * traps, its one-in-N rate, and the rate limit of the calling process. The
+ * limits on budget and processes are token buckets, which hold up to one
+ * second of tokens and refill continuously.
+ *
+ * Skipping a call spares the callbacks and the trap of its return, but the
+ * call has already cost an exit. Only disarming the breakpoint spares that,
+ * so a sampler which exhausts its budget, or whose duty cycle is off, asks
+ * the loop to restore the original instruction. The loop's periodic tick
+ * then asks gt_sampler_should_arm() when to put the breakpoint back.
+ */
+
+#define GT_NS_PER_S G_GUINT64_CONSTANT(1000000000)
+#define GT_NS_PER_MS G_GUINT64_CONSTANT(1000000)
+
+/* Processes with no calls for this long forget their bucket, which is full. */
+#define GT_SAMPLER_IDLE_NS (2 * GT_NS_PER_S)
+
+typedef struct gt_token_bucket {
+	gdouble tokens;
+	guint64 updated; /* Time of the last refill. */
+} gt_token_bucket;
+
+struct gt_sampler {
+	GtSampling      sampling;
+	guint64         start;     /* Origin of the duty cycle. */
+	guint64         passed;    /* Calls considered by the one-in-N rate. */
+	gt_token_bucket budget;
+	GHashTable     *processes; /* PID to gt_token_bucket, with a process rate. */
+	guint64         pruned;    /* Time idle processes were last forgotten. */
+};
+
+/* Add the tokens which rate grants per second since the last refill. */
+static void
+gt_token_bucket_refill(gt_token_bucket *bucket, guint rate, guint64 now)
+{
+	if (now > bucket->updated) {
+		bucket->tokens += (gdouble) rate * (now - bucket->updated) / GT_NS_PER_S;
+		bucket->tokens  = MIN(bucket->tokens, rate);
+	}
+
+	bucket->updated = now;
+}
+
+/* Refill bucket, and take a token if one is left. */
+static gboolean
+gt_token_bucket_take(gt_token_bucket *bucket, guint rate, guint64 now)
+{
+	gt_token_bucket_refill(bucket, rate, now);
+
+	if (bucket->tokens < 1) {
+		return FALSE;
+	}
+
+	bucket->tokens -= 1;
+
+	return TRUE;
+}
+
+/* Create a sampler which applies sampling, beginning its duty cycle at now. */
+gt_sampler *
+gt_sampler_new(const GtSampling *sampling, guint64 now)
+{
+	gt_sampler *sampler = g_new0(gt_sampler, 1);
+
+	sampler->sampling       = *sampling;
+	sampler->start          = now;
+	sampler->budget.tokens  = sampling->budget;
+	sampler->budget.updated = now;
+	sampler->pruned         = now;
+
+	if (0 != sampling->process_rate) {
+		sampler->processes = g_hash_table_new_full(NULL, NULL, NULL, g_free);
+	}
+
+	return sampler;
+}
+
+/* Decide whether to pass a call which pid made at now to the callbacks. */
+gt_sample_verdict
+gt_sampler_admit(gt_sampler *sampler, gt_pid_t pid, guint64 now)
+{
+	const GtSampling *sampling = &sampler->sampling;
+	gt_sample_verdict verdict = GT_SAMPLE_SKIP;
+	gt_token_bucket *bucket;
+
+	if (0 != sampling->budget && !gt_token_bucket_take(&sampler->budget, sampling->budget, now)) {
+		verdict = GT_SAMPLE_DISARM;
+		goto done;
+	}
+
+	if (sampling->every > 1 && 0 != sampler->passed++ % sampling->every) {
+		goto done;
+	}
+
+	if (NULL != sampler->processes) {
+		bucket = g_hash_table_lookup(sampler->processes, GINT_TO_POINTER(pid));
+		if (NULL == bucket) {
+			bucket = g_new(gt_token_bucket, 1);
+			bucket->tokens  = sampling->process_rate;
+			bucket->updated = now;
+			g_hash_table_insert(sampler->processes, GINT_TO_POINTER(pid), bucket);
+		}
+
+		if (!gt_token_bucket_take(bucket, sampling->process_rate, now)) {
+			goto done;
+		}
+	}
+
+	verdict = GT_SAMPLE_PASS;
+
+done:
+	return verdict;
+}
+
+static gboolean
+gt_sampler_idle(gpointer key, gpointer value, gpointer data)
+{
+	const gt_token_bucket *bucket = value;
+	guint64 now = *(const guint64 *) data;
+
+	return now - bucket->updated > GT_SAMPLER_IDLE_NS;
+}
+
+/*
+ * Return whether the breakpoint should be armed at now: that is, whether the
+ * duty cycle is on, and whether the budget has replenished. The loop calls
+ * this periodically, which also gives the sampler a chance to forget idle
+ * processes.
+ */
+gboolean
+gt_sampler_should_arm(gt_sampler *sampler, guint64 now)
+{
+	const GtSampling *sampling = &sampler->sampling;
+	gboolean arm = TRUE;
+
+	if (NULL != sampler->processes && now - sampler->pruned > GT_SAMPLER_IDLE_NS) {
+		g_hash_table_foreach_remove(sampler->processes, gt_sampler_idle, &now);
+		sampler->pruned = now;
+	}
+
+	if (0 != sampling->duty_period_ms) {
+		guint64 phase = (now - sampler->start) % (sampling->duty_period_ms * GT_NS_PER_MS);
+
+		if (phase >= sampling->duty_on_ms * GT_NS_PER_MS) {
+			arm = FALSE;
+			goto done;
+		}
+	}
+
+	if (0 != sampling->budget) {
+		gt_token_bucket_refill(&sampler->budget, sampling->budget, now);
+		arm = sampler->budget.tokens >= 1;
+	}
+
+done:
+	return arm;
+}
+
+void
+gt_sampler_free(gt_sampler *sampler)
+{
+	if (NULL == sampler) {
+		goto done;
+	}
+
+	if (NULL != sampler->processes) {
+		g_hash_table_destroy(sampler->processes);
+	}
+
+	g_free(sampler);
+
+done:
+	return;
+}
@@ -0,0 +1,20 @@
+#ifndef SAMPLING_H
+#define SAMPLING_H
+
+#include "guestrace.h"
+
+/* What gt_sampler_admit() decides about one call. */
+typedef enum gt_sample_verdict {
+	GT_SAMPLE_PASS,   /* Pass the call to the callbacks. */
+	GT_SAMPLE_SKIP,   /* Count the call, but do not pass it on. */
+	GT_SAMPLE_DISARM, /* Skip, and disarm the breakpoint; over budget. */
+} gt_sample_verdict;
+
+typedef struct gt_sampler gt_sampler;
+
+gt_sampler       *gt_sampler_new(const GtSampling *sampling, guint64 now);
+gt_sample_verdict gt_sampler_admit(gt_sampler *sampler, gt_pid_t pid, guint64 now);
+gboolean          gt_sampler_should_arm(gt_sampler *sampler, guint64 now);
+void              gt_sampler_free(gt_sampler *sampler);
+
+#endif
@@ -0,0 +1,566 @@
+#include <glib.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "sinks.h"
+
+struct text_sink {
+	gt_sink  parent;
+	GtOSType os;
+	FILE    *out;
+	char    *prefix; /* Begins each line if not NULL. */
+};
+
+struct json_sink {
+	gt_sink  parent;
+	FILE    *out;
+	char    *guest;  /* Named in each object if not NULL. */
+};
+
+struct binary_sink {
+	gt_sink          parent;
+	gt_binary_trace *trace;
+};
+
+struct export_sink {
+	gt_sink    parent;
+	gt_export *export;
+};
+
+static const char *
+get_process_name(GtGuestState *state, gt_pid_t pid)
+{
+	const char *proc = gt_guest_get_process_name(state, pid);
+
+	return NULL == proc ? "unknown" : proc;
+}
+
+/* Keep printing "(null)" for strings which could not be read, as printf() does. */
+static const char *
+text_string(const char *string)
+{
+	return NULL == string ? "(null)" : string;
+}
+
+static void
+text_arg(FILE *out, const gt_decoded_arg *arg)
+{
+	if (NULL != arg->desc->name) {
+		fprintf(out, "%s: ", arg->desc->name);
+	}
+
+	switch (arg->desc->kind) {
+	case GT_ARG_UINT:
+		fprintf(out, "%lu", (unsigned long) arg->raw);
+		break;
+	case GT_ARG_INT:
+		fprintf(out, "%i", (int) arg->raw);
+		break;
+	case GT_ARG_LONG:
+		fprintf(out, "%li", (long int) arg->raw);
+		break;
+	case GT_ARG_CSTR:
+		fprintf(out, "\"%s\"", text_string(arg->string));
+		break;
+	case GT_ARG_USTR:
+		fputs(text_string(arg->string), out);
+		break;
+	case GT_ARG_OBJECT_ATTRIBUTES:
+		fprintf(out,
+		        "RootDirectory = 0x%"PRIx64" | ObjectName = %s | Attributes = 0x%"PRIx64,
+		        arg->root_directory,
+		        text_string(arg->string),
+		        arg->attributes);
+		break;
+	case GT_ARG_ACCESS_MASK:
+		fprintf(out, "%s [0x%"PRIx64"]", text_string(arg->string), arg->raw);
+		break;
+	case GT_ARG_BOOLEAN:
+		fputs(arg->raw ? "TRUE" : "FALSE", out);
+		break;
+	case GT_ARG_PVALUE:
+		fprintf(out, "0x%"PRIx64, arg->value);
+		break;
+	case GT_ARG_PTR:
+	default:
+		fprintf(out, "0x%"PRIx64, arg->raw);
+		break;
+	}
+}
+
+static void
+text_args(FILE *out, const gt_decoded_arg *args, guint count)
+{
+	for (guint i = 0; i < count; i++) {
+		if (i > 0) {
+			fputs(", ", out);
+		}
+		text_arg(out, &args[i]);
+	}
+}
+
+/* Print the part of each line which precedes the description of the event. */
+static void
+text_begin(struct text_sink *sink, const gt_decode_event *event)
+{
+	if (NULL != sink->prefix) {
+		fprintf(sink->out, "%s: ", sink->prefix);
+	}
+
+	fprintf(sink->out,
+	        "pid: %u/0x%"PRIx64" (%s) ",
+	        event->pid,
+	        event->tid,
+	        get_process_name(event->state, event->pid));
+}
+
+/*
+ * Holding the lock on the stream keeps the lines of several guests, which
+ * print from their own threads, from mixing.
+ */
+static void
+text_call(gt_sink *parent,
+          const gt_decode_event *event,
+          const gt_decoded_arg *args,
+          guint count)
+{
+	struct text_sink *sink = (struct text_sink *) parent;
+
+	flockfile(sink->out);
+	text_begin(sink, event);
+	fprintf(sink->out, "syscall: %s(", event->hook->desc->name);
+	text_args(sink->out, args, count);
+	fputs(")\n", sink->out);
+	funlockfile(sink->out);
+}
+
+static void
+text_ret(gt_sink *parent,
+         const gt_decode_event *event,
+         gt_reg_t retval,
+         const gt_decoded_arg *args,
+         guint count)
+{
+	struct text_sink *sink = (struct text_sink *) parent;
+
+	flockfile(sink->out);
+	text_begin(sink, event);
+	if (GT_OS_WINDOWS == sink->os) {
+		fprintf(sink->out, "sysret: Status(0x%"PRIx64") OUT(", retval);
+		text_args(sink->out, args, count);
+		fputs(")\n", sink->out);
+	} else {
+		fprintf(sink->out, "return: 0x%"PRIx64"\n", retval);
+	}
+	funlockfile(sink->out);
+}
+
+static void
+text_free(gt_sink *parent)
+{
+	struct text_sink *sink = (struct text_sink *) parent;
+
+	g_free(sink->prefix);
+	g_free(sink);
+}
+
+/*
+ * Create a sink which prints a line of text to out for each event, in the
+ * style guestrace has always used for the guest's OS. Each line begins with
+ * prefix if it is not NULL.
+ */
+gt_sink *
+gt_text_sink_new(GtOSType os, FILE *out, const char *prefix)
+{
+	struct text_sink *sink = g_new0(struct text_sink, 1);
+
+	sink->parent.decode = TRUE;
+	sink->parent.call   = text_call;
+	sink->parent.ret    = text_ret;
+	sink->parent.free   = text_free;
+	sink->os            = os;
+	sink->out           = out;
+	sink->prefix        = g_strdup(prefix);
+
+	return &sink->parent;
+}
+
+/*
+ * Print string as a JSON string. Guest strings need not be UTF-8, so escape
+ * each byte beyond ASCII of an invalid string as the Latin-1 character it
+ * would be.
+ */
+static void
+json_string(FILE *out, const char *string)
+{
+	gboolean valid;
+
+	if (NULL == string) {
+		fputs("null", out);
+		goto done;
+	}
+
+	valid = g_utf8_validate(string, -1, NULL);
+
+	putc('"', out);
+
+	for (const unsigned char *c = (const unsigned char *) string; '\0' != *c; c++) {
+		switch (*c) {
+		case '"':
+			fputs("\\\"", out);
+			break;
+		case '\\':
+			fputs("\\\\", out);
+			break;
+		case '\n':
+			fputs("\\n", out);
+			break;
+		case '\t':
+			fputs("\\t", out);
+			break;
+		default:
+			if (*c < 0x20 || (*c >= 0x80 && !valid)) {
+				fprintf(out, "\\u%04x", *c);
+			} else {
+				putc(*c, out);
+			}
+			break;
+		}
+	}
+
+	putc('"', out);
+
+done:
+	return;
+}
+
+/* Print pointers as strings, since many JSON parsers cannot hold 64 bits in a number. */
+static void
+json_pointer(FILE *out, gt_reg_t value)
+{
+	fprintf(out, "\"0x%"PRIx64"\"", value);
+}
+
+static void
+json_arg(FILE *out, const gt_decode_event *event, const gt_decoded_arg *arg)
+{
+	if (NULL != arg->desc->name) {
+		json_string(out, arg->desc->name);
+	} else {
+		fprintf(out, "\"arg%ld\"", (long) (arg->desc - event->hook->desc->args));
+	}
+
+	putc(':', out);
+
+	switch (arg->desc->kind) {
+	case GT_ARG_UINT:
+		fprintf(out, "%"PRIu64, arg->raw);
+		break;
+	case GT_ARG_INT:
+		fprintf(out, "%i", (int) arg->raw);
+		break;
+	case GT_ARG_LONG:
+		fprintf(out, "%"PRIi64, (int64_t) arg->raw);
+		break;
+	case GT_ARG_CSTR:
+	case GT_ARG_USTR:
+		json_string(out, arg->string);
+		break;
+	case GT_ARG_OBJECT_ATTRIBUTES:
+		fputs("{\"RootDirectory\":", out);
+		json_pointer(out, arg->root_directory);
+		fputs(",\"ObjectName\":", out);
+		json_string(out, arg->string);
+		fprintf(out, ",\"Attributes\":%"PRIu64"}", arg->attributes);
+		break;
+	case GT_ARG_ACCESS_MASK:
+		fprintf(out, "{\"mask\":%"PRIu64",\"flags\":", arg->raw);
+		json_string(out, arg->string);
+		putc('}', out);
+		break;
+	case GT_ARG_BOOLEAN:
+		fputs(arg->raw ? "true" : "false", out);
+		break;
+	case GT_ARG_PVALUE:
+		fprintf(out, "%"PRIu64, arg->value);
+		break;
+	case GT_ARG_PTR:
+	default:
+		json_pointer(out, arg->raw);
+		break;
+	}
+}
+
+/* Print the members which describe any event, up to the event's type. */
+static void
+json_begin(struct json_sink *sink, const gt_decode_event *event, const char *type)
+{
+	putc('{', sink->out);
+
+	if (NULL != sink->guest) {
+		fputs("\"guest\":", sink->out);
+		json_string(sink->out, sink->guest);
+		putc(',', sink->out);
+	}
+
+	fprintf(sink->out,
+	        "\"time\":%"PRIi64",\"vcpu\":%u,\"pid\":%u,\"tid\":",
+	        (int64_t) g_get_real_time(),
+	        gt_guest_get_vmi_event(event->state)->vcpu_id,
+	        event->pid);
+	json_pointer(sink->out, event->tid);
+	fputs(",\"process\":", sink->out);
+	json_string(sink->out, get_process_name(event->state, event->pid));
+	fprintf(sink->out, ",\"event\":\"%s\",\"syscall\":", type);
+	json_string(sink->out, event->hook->desc->name);
+}
+
+/* Print the args member and end the object, and so the line. */
+static void
+json_end(struct json_sink *sink,
+         const gt_decode_event *event,
+         const gt_decoded_arg *args,
+         guint count)
+{
+	fputs(",\"args\":{", sink->out);
+
+	for (guint i = 0; i < count; i++) {
+		if (i > 0) {
+			putc(',', sink->out);
+		}
+		json_arg(sink->out, event, &args[i]);
+	}
+
+	fputs("}}\n", sink->out);
+}
+
+static void
+json_call(gt_sink *parent,
+          const gt_decode_event *event,
+          const gt_decoded_arg *args,
+          guint count)
+{
+	struct json_sink *sink = (struct json_sink *) parent;
+
+	flockfile(sink->out);
+	json_begin(sink, event, "call");
+	json_end(sink, event, args, count);
+	funlockfile(sink->out);
+}
+
+static void
+json_ret(gt_sink *parent,
+         const gt_decode_event *event,
+         gt_reg_t retval,
+         const gt_decoded_arg *args,
+         guint count)
+{
+	struct json_sink *sink = (struct json_sink *) parent;
+
+	flockfile(sink->out);
+	json_begin(sink, event, "return");
+	fputs(",\"retval\":", sink->out);
+	json_pointer(sink->out, retval);
+	json_end(sink, event, args, count);
+	funlockfile(sink->out);
+}
+
+static void
+json_free(gt_sink *parent)
+{
+	struct json_sink *sink = (struct json_sink *) parent;
+
+	g_free(sink->guest);
+	g_free(sink);
+}
+
+/*
+ * Create a sink which prints a JSON object to out for each event, one object
+ * per line. Each object names guest if it is not NULL.
+ */
+gt_sink *
+gt_json_sink_new(FILE *out, const char *guest)
+{
+	struct json_sink *sink = g_new0(struct json_sink, 1);
+
+	sink->parent.decode = TRUE;
+	sink->parent.call   = json_call;
+	sink->parent.ret    = json_ret;
+	sink->parent.free   = json_free;
+	sink->out           = out;
+	sink->guest         = g_strdup(guest);
+
+	return &sink->parent;
+}
+
+/* Fill in the fields common to call and return records. */
+static void
+binary_fill(gt_binary_record *record, const gt_decode_event *event)
+{
+	record->timestamp = g_get_real_time();
+	record->tid       = event->tid;
+	record->pid       = event->pid;
+	record->vcpu      = gt_guest_get_vmi_event(event->state)->vcpu_id;
+	record->syscall   = event->hook->index;
+	record->size      = 0;
+}
+
+/*
+ * Records hold raw argument values and leave decoding to tools such as
+ * tools/guestrace-decode, so this sink asks the decoder for nothing unless
+ * it captures memory for a replay.
+ */
+static void
+binary_call(gt_sink *parent,
+            const gt_decode_event *event,
+            const gt_decoded_arg *args,
+            guint count)
+{
+	struct binary_sink *sink = (struct binary_sink *) parent;
+	GtArgs *guest_args = gt_guest_get_args(event->state);
+	uint64_t values[GT_BINARY_TRACE_ARGS];
+	gt_binary_record *record;
+
+	/* Reading a stack argument might itself add a memory record. */
+	for (guint i = 0; i < GT_BINARY_TRACE_ARGS; i++) {
+		values[i] = gt_args_get(guest_args, i);
+	}
+
+	record = gt_binary_trace_reserve(sink->trace);
+
+	binary_fill(record, event);
+	record->type   = GT_BINARY_RECORD_CALL;
+	record->retval = 0;
+	memcpy(record->args, values, sizeof(record->args));
+
+	gt_binary_trace_commit(sink->trace);
+}
+
+static void
+binary_ret(gt_sink *parent,
+           const gt_decode_event *event,
+           gt_reg_t retval,
+           const gt_decoded_arg *args,
+           guint count)
+{
+	struct binary_sink *sink = (struct binary_sink *) parent;
+	gt_binary_record *record = gt_binary_trace_reserve(sink->trace);
+
+	binary_fill(record, event);
+	record->type   = GT_BINARY_RECORD_RETURN;
+	record->retval = retval;
+	memset(record->args, 0x00, sizeof(record->args));
+
+	gt_binary_trace_commit(sink->trace);
+}
+
+static void
+binary_free(gt_sink *parent)
+{
+	g_free(parent);
+}
+
+/*
+ * Create a sink which writes a record to trace for each event. The syscall
+ * field of each record is the index of the system call in its registry. If
+ * capture, the sink has the decoder read each argument as the text sink
+ * would, so that a GtMemoryFunc can record that memory; see
+ * gt_loop_set_memory_cb().
+ */
+gt_sink *
+gt_binary_sink_new(gt_binary_trace *trace, gboolean capture)
+{
+	struct binary_sink *sink = g_new0(struct binary_sink, 1);
+
+	sink->parent.decode = capture;
+	sink->parent.call   = binary_call;
+	sink->parent.ret    = binary_ret;
+	sink->parent.free   = binary_free;
+	sink->trace         = trace;
+
+	return &sink->parent;
+}
+
+/* Like binary_call(), but for an export, which might drop the record. */
+static void
+export_call(gt_sink *parent,
+            const gt_decode_event *event,
+            const gt_decoded_arg *args,
+            guint count)
+{
+	struct export_sink *sink = (struct export_sink *) parent;
+	GtArgs *guest_args = gt_guest_get_args(event->state);
+	uint64_t values[GT_BINARY_TRACE_ARGS];
+	gt_binary_record *record;
+
+	/* Read guest memory before holding the export's lock. */
+	for (guint i = 0; i < GT_BINARY_TRACE_ARGS; i++) {
+		values[i] = gt_args_get(guest_args, i);
+	}
+
+	record = gt_export_reserve(sink->export, sizeof *record);
+	if (NULL == record) {
+		goto done;
+	}
+
+	binary_fill(record, event);
+	record->type   = GT_BINARY_RECORD_CALL;
+	record->retval = 0;
+	memcpy(record->args, values, sizeof(record->args));
+
+	gt_export_commit(sink->export);
+
+done:
+	return;
+}
+
+static void
+export_ret(gt_sink *parent,
+           const gt_decode_event *event,
+           gt_reg_t retval,
+           const gt_decoded_arg *args,
+           guint count)
+{
+	struct export_sink *sink = (struct export_sink *) parent;
+	gt_binary_record *record = gt_export_reserve(sink->export, sizeof *record);
+
+	if (NULL == record) {
+		goto done;
+	}
+
+	binary_fill(record, event);
+	record->type   = GT_BINARY_RECORD_RETURN;
+	record->retval = retval;
+	memset(record->args, 0x00, sizeof(record->args));
+
+	gt_export_commit(sink->export);
+
+done:
+	return;
+}
+
+static void
+export_free(gt_sink *parent)
+{
+	g_free(parent);
+}
+
+/*
+ * Create a sink which sends a binary record, as gt_binary_sink_new() would
+ * write, to export for each event. For JSON, pass the stream of the export
+ * to gt_json_sink_new() instead.
+ */
+gt_sink *
+gt_export_sink_new(gt_export *export)
+{
+	struct export_sink *sink = g_new0(struct export_sink, 1);
+
+	sink->parent.decode = FALSE;
+	sink->parent.call   = export_call;
+	sink->parent.ret    = export_ret;
+	sink->parent.free   = export_free;
+	sink->export        = export;
+
+	return &sink->parent;
+}
@@ -0,0 +1,15 @@
+#ifndef SINKS_H
+#define SINKS_H
+
+#include <stdio.h>
+
+#include "binary-trace.h"
+#include "decoder.h"
+#include "export.h"
+
+gt_sink *gt_text_sink_new(GtOSType os, FILE *out, const char *prefix);
+gt_sink *gt_json_sink_new(FILE *out, const char *guest);
+gt_sink *gt_binary_sink_new(gt_binary_trace *trace, gboolean capture);
+gt_sink *gt_export_sink_new(gt_export *export);
+
+#endif
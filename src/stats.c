@@ -0,0 +1,193 @@
+#include <glib.h>
+
+#include "stats.h"
+
+static const char *GT_PHASE_NAMES[GT_PHASE_COUNT] = {
+	[GT_PHASE_LOOKUP]      = "lookup",
+	[GT_PHASE_PID]         = "pid",
+	[GT_PHASE_CALLBACK]    = "callback",
+	[GT_PHASE_STACK_WRITE] = "stack write",
+	[GT_PHASE_RIP_SET]     = "rip set",
+};
+
+/* Return the largest value which falls in bucket. */
+static guint64
+gt_histogram_bucket_max(guint bucket)
+{
+	guint msb, shift;
+	guint64 low;
+
+	if (bucket < (1u << GT_HISTOGRAM_SUB_BITS)) {
+		return bucket;
+	}
+
+	msb   = (bucket >> GT_HISTOGRAM_SUB_BITS) + GT_HISTOGRAM_SUB_BITS - 1;
+	shift = msb - GT_HISTOGRAM_SUB_BITS;
+	low   = (guint64) ((1u << GT_HISTOGRAM_SUB_BITS)
+	                 | (bucket & ((1u << GT_HISTOGRAM_SUB_BITS) - 1))) << shift;
+
+	return low + (G_GUINT64_CONSTANT(1) << shift) - 1;
+}
+
+/**
+ * gt_histogram_percentile:
+ * @histogram: a #GtHistogram.
+ * @percentile: a percentile between 0 and 100.
+ *
+ * Returns: an upper bound, within the precision of @histogram, on the
+ * durations below which @percentile percent of the recorded durations fall;
+ * or zero if @histogram is empty.
+ */
+guint64
+gt_histogram_percentile(const GtHistogram *histogram, double percentile)
+{
+	guint64 rank, seen = 0, value = 0;
+
+	if (0 == histogram->count) {
+		goto done;
+	}
+
+	percentile = CLAMP(percentile, 0.0, 100.0);
+	rank       = MAX(1, (guint64) (percentile / 100.0 * histogram->count + 0.5));
+
+	for (guint i = 0; i < GT_HISTOGRAM_BUCKETS; i++) {
+		seen += histogram->buckets[i];
+		if (seen >= rank) {
+			value = MIN(gt_histogram_bucket_max(i), histogram->max);
+			break;
+		}
+	}
+
+done:
+	return value;
+}
+
+/**
+ * gt_stats_format:
+ * @stats: a #GtStats.
+ *
+ * Describes @stats in human-readable text: the counters and phase timings
+ * of each VCPU, then the counters of each callback which has run and of
+ * each page which guest accesses have touched.
+ *
+ * Returns: the text, which the caller must free with g_free().
+ */
+char *
+gt_stats_format(const GtStats *stats)
+{
+	GString *text = g_string_new(NULL);
+
+	for (guint i = 0; i < stats->vcpu_count; i++) {
+		const GtVcpuStats *vcpu = &stats->vcpus[i];
+
+		g_string_append_printf(text,
+		                       "vcpu %u: calls %"G_GUINT64_FORMAT
+		                       " returns %"G_GUINT64_FORMAT
+		                       " orphaned returns %"G_GUINT64_FORMAT
+		                       " reinjected %"G_GUINT64_FORMAT
+		                       " mem rw %"G_GUINT64_FORMAT
+		                       " single steps %"G_GUINT64_FORMAT"\n",
+		                       i,
+		                       vcpu->calls,
+		                       vcpu->returns,
+		                       vcpu->orphaned_returns,
+		                       vcpu->reinjected,
+		                       vcpu->mem_rw,
+		                       vcpu->single_steps);
+
+		for (guint j = 0; j < GT_PHASE_COUNT; j++) {
+			const GtHistogram *phase = &vcpu->phases[j];
+
+			if (0 == phase->count) {
+				continue;
+			}
+
+			g_string_append_printf(text,
+			                       "  %-11s count %"G_GUINT64_FORMAT
+			                       " mean %"G_GUINT64_FORMAT
+			                       " p50 %"G_GUINT64_FORMAT
+			                       " p99 %"G_GUINT64_FORMAT
+			                       " max %"G_GUINT64_FORMAT" ns\n",
+			                       GT_PHASE_NAMES[j],
+			                       phase->count,
+			                       phase->sum / phase->count,
+			                       gt_histogram_percentile(phase, 50),
+			                       gt_histogram_percentile(phase, 99),
+			                       phase->max);
+		}
+	}
+
+	for (guint i = 0; i < stats->syscall_count; i++) {
+		const GtSyscallStats *syscall = &stats->syscalls[i];
+
+		if (0 == syscall->calls && 0 == syscall->skipped) {
+			continue;
+		}
+
+		g_string_append_printf(text,
+		                       "%s: calls %"G_GUINT64_FORMAT
+		                       " returns %"G_GUINT64_FORMAT,
+		                       syscall->name,
+		                       syscall->calls,
+		                       syscall->returns);
+
+		if (0 != syscall->skipped || 0 != syscall->disarms) {
+			g_string_append_printf(text,
+			                       " skipped %"G_GUINT64_FORMAT
+			                       " disarms %"G_GUINT64_FORMAT,
+			                       syscall->skipped,
+			                       syscall->disarms);
+		}
+
+		g_string_append_c(text, '\n');
+	}
+
+	for (guint i = 0; i < stats->page_count; i++) {
+		const GtPageStats *page = &stats->pages[i];
+
+		if (0 == page->mem_rw && 0 == page->exec_returns) {
+			continue;
+		}
+
+		g_string_append_printf(text,
+		                       "page 0x%"G_GINT64_MODIFIER"x: mem rw %"G_GUINT64_FORMAT
+		                       " single steps %"G_GUINT64_FORMAT
+		                       " view switches %"G_GUINT64_FORMAT
+		                       " exec returns %"G_GUINT64_FORMAT
+		                       " exits avoided %"G_GUINT64_FORMAT"\n",
+		                       (guint64) page->frame,
+		                       page->mem_rw,
+		                       page->single_steps,
+		                       page->view_switches,
+		                       page->exec_returns,
+		                       page->exits_avoided);
+	}
+
+	return g_string_free(text, FALSE);
+}
+
+/**
+ * gt_stats_free:
+ * @stats: a #GtStats, or NULL.
+ *
+ * Frees a snapshot which gt_loop_get_stats() returned.
+ */
+void
+gt_stats_free(GtStats *stats)
+{
+	if (NULL == stats) {
+		goto done;
+	}
+
+	for (guint i = 0; i < stats->syscall_count; i++) {
+		g_free(stats->syscalls[i].name);
+	}
+
+	g_free(stats->syscalls);
+	g_free(stats->pages);
+	g_free(stats->vcpus);
+	g_free(stats);
+
+done:
+	return;
+}
@@ -0,0 +1,64 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <time.h>
+
+#include "guestrace.h"
+
+/*
+ * Each GtLoop counts events in an array of GtVcpuStats. Only the thread
+ * which services the loop's events writes the counters, and it does so
+ * while holding the loop's lock, which it holds anyway; so the counters
+ * need neither atomic operations nor locks of their own.
+ */
+
+/* Octaves below this one have a bucket for each value; see GtHistogram. */
+#define GT_HISTOGRAM_SUB_BITS 3
+
+/* Return a timestamp in nanoseconds for timing the phases of an event. */
+static inline guint64
+gt_stats_now(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (guint64) now.tv_sec * G_GUINT64_CONSTANT(1000000000) + now.tv_nsec;
+}
+
+static inline guint
+gt_histogram_bucket(guint64 value)
+{
+	guint msb, bucket;
+
+	if (value < (1u << GT_HISTOGRAM_SUB_BITS)) {
+		return value;
+	}
+
+	msb    = 63 - __builtin_clzll(value);
+	bucket = ((msb - GT_HISTOGRAM_SUB_BITS + 1) << GT_HISTOGRAM_SUB_BITS)
+	       + ((value >> (msb - GT_HISTOGRAM_SUB_BITS)) & ((1u << GT_HISTOGRAM_SUB_BITS) - 1));
+
+	return MIN(bucket, GT_HISTOGRAM_BUCKETS - 1);
+}
+
+static inline void
+gt_histogram_add(GtHistogram *histogram, guint64 value)
+{
+	histogram->count++;
+	histogram->sum += value;
+	histogram->max  = MAX(histogram->max, value);
+	histogram->buckets[gt_histogram_bucket(value)]++;
+}
+
+/* Add the time since *since to the histogram of phase, and restart *since. */
+static inline void
+gt_stats_lap(GtVcpuStats *stats, GtPhase phase, guint64 *since)
+{
+	guint64 now = gt_stats_now();
+
+	gt_histogram_add(&stats->phases[phase], now - *since);
+	*since = now;
+}
+
+#endif
@@ -0,0 +1,151 @@
+/*
+ * Checks, against the mock guest of mock-libvmi.c, that a callback on a
+ * process-lifecycle function set once the loop has attached takes over the
+ * breakpoint which gt_set_up_process_lifecycle_hooks() placed there, and
+ * that gt_loop_remove_cb() hands it back. "make check" runs it; it exits
+ * with a nonzero status on failure. Including trace-syscalls.c exposes
+ * gt_set_up_process_lifecycle_hooks() and gt_breakpoint_cb() to the test.
+ */
+
+#include "trace-syscalls.c"
+
+#include "mock-libvmi.h"
+
+/* Where the lifecycle functions live in the mock guest; see main(). */
+#define TEST_FUNCS 0xffffffff81100010ull
+
+/* A free frame of the mock guest, for the shadow page of TEST_FUNCS. */
+#define TEST_SHADOW_FRAME 0x300
+
+static guint test_calls;
+
+static void *
+test_syscall_cb(GtGuestState *state, gt_pid_t pid, gt_tid_t tid, void *user_data)
+{
+	test_calls++;
+
+	return NULL;
+}
+
+static void
+test_sysret_cb(GtGuestState *state, gt_pid_t pid, gt_tid_t tid, void *user_data)
+{
+}
+
+/*
+ * Check that the breakpoint on kernel_func still flushes the process caches
+ * and calls syscall_cb and sysret_cb with data. Returns FALSE, with a
+ * message, on failure.
+ */
+static gboolean
+test_record(GtLoop *loop,
+            const char *kernel_func,
+            GtSyscallFunc syscall_cb,
+            GtSysretFunc sysret_cb,
+            void *data)
+{
+	gboolean ok = FALSE;
+	gt_paddr_record *record = gt_paddr_record_from_name(loop, kernel_func);
+
+	if (NULL == record) {
+		fprintf(stderr, "%s: no breakpoint\n", kernel_func);
+		goto done;
+	}
+
+	if (!record->flushes_process_caches || !record->enabled) {
+		fprintf(stderr, "%s: breakpoint no longer flushes caches\n", kernel_func);
+		goto done;
+	}
+
+	if (syscall_cb != record->syscall_cb
+	 || sysret_cb  != record->sysret_cb
+	 || data       != record->data) {
+		fprintf(stderr, "%s: breakpoint has the wrong callbacks\n", kernel_func);
+		goto done;
+	}
+
+	ok = TRUE;
+
+done:
+	return ok;
+}
+
+/* Have the guest call kernel_func, and return the calls to test_syscall_cb(). */
+static guint
+test_call(GtLoop *loop, const char *kernel_func)
+{
+	x86_registers_t regs = { .cr3 = 426 << 12, .rsp = 0xffffc90000010000ull };
+	vmi_event_t event = { .data = loop, .vcpu_id = 0, .x86_regs = &regs };
+
+	event.interrupt_event.gla = gt_attach_cache_ksym2v(loop, kernel_func);
+
+	test_calls = 0;
+	gt_breakpoint_cb(loop->vmi, &event);
+
+	return test_calls;
+}
+
+int
+main(int argc, char *argv[])
+{
+	int fnval = EXIT_FAILURE;
+	GtLoop *loop;
+	const char * const funcs[] = { "sys_execve", "wake_up_new_task", "sys_exit_group", "do_exit" };
+	int data;
+
+	loop = _gt_loop_alloc("test");
+	loop->vmi          = mock_vmi_new(VMI_OS_LINUX);
+	loop->os           = VMI_OS_LINUX;
+	loop->os_functions = &os_functions_linux;
+	loop->shadow_view  = 1;
+
+	/* One page holds every lifecycle function, so one shadow page will do. */
+	for (guint i = 0; i < G_N_ELEMENTS(funcs); i++) {
+		mock_vmi_set_symbol(loop->vmi, funcs[i], TEST_FUNCS + 0x40 * i);
+	}
+
+	loop->spare_shadow_frames      = g_new(xen_pfn_t, 1);
+	loop->spare_shadow_frames[0]   = TEST_SHADOW_FRAME;
+	loop->spare_shadow_frame_count = 1;
+
+	/* As gt_loop_run() does once it has attached. */
+	gt_set_up_process_lifecycle_hooks(loop);
+
+	if (!test_record(loop, "sys_execve", gt_lifecycle_syscall_cb, gt_lifecycle_sysret_cb, NULL)
+	 || !test_record(loop, "do_exit", gt_lifecycle_syscall_cb, NULL, NULL)) {
+		goto done;
+	}
+
+	if (!gt_loop_set_cb(loop, "sys_execve", test_syscall_cb, test_sysret_cb, &data)
+	 || !gt_loop_set_cb(loop, "do_exit", test_syscall_cb, NULL, &data)) {
+		fprintf(stderr, "setting a callback on a lifecycle function failed\n");
+		goto done;
+	}
+
+	if (!test_record(loop, "sys_execve", test_syscall_cb, test_sysret_cb, &data)
+	 || !test_record(loop, "do_exit", test_syscall_cb, NULL, &data)) {
+		goto done;
+	}
+
+	if (1 != test_call(loop, "do_exit")) {
+		fprintf(stderr, "do_exit: callback did not run\n");
+		goto done;
+	}
+
+	if (!gt_loop_remove_cb(loop, "do_exit")
+	 || !test_record(loop, "do_exit", gt_lifecycle_syscall_cb, NULL, NULL)) {
+		goto done;
+	}
+
+	if (0 != test_call(loop, "do_exit")) {
+		fprintf(stderr, "do_exit: removed callback still runs\n");
+		goto done;
+	}
+
+	fnval = EXIT_SUCCESS;
+
+done:
+	gt_loop_free(loop);
+
+	return fnval;
+}
@@ -0,0 +1,135 @@
+/*
+ * Checks, against the mock guest of mock-libvmi.c, that guestrace single-steps
+ * every VCPU over its breakpoints, including those beyond the first
+ * GT_STEP_MASK_VCPUS, which a libvmi step event's mask cannot name, and one
+ * which appears only once the loop is running. "make check" runs it; it
+ * exits with a nonzero status on failure. Including trace-syscalls.c exposes
+ * gt_breakpoint_cb() and gt_singlestep_cb() to the test.
+ */
+
+#include "trace-syscalls.c"
+
+#include "mock-libvmi.h"
+
+/* VCPUs which the mock guest reports at start-up. */
+#define TEST_VCPUS 48
+
+/* A kernel function in the mock guest; it translates to a nonzero address. */
+#define TEST_FUNC 0xffffffff81100000ull
+
+static void *
+test_syscall_cb(GtGuestState *state, gt_pid_t pid, gt_tid_t tid, void *user_data)
+{
+	return NULL;
+}
+
+/*
+ * Have VCPU vcpu_id hit record's breakpoint and then complete the step over
+ * it, as the guest would, checking that guestrace turns stepping on and then
+ * off again. Returns FALSE, with a message, on failure.
+ */
+static gboolean
+test_step(GtLoop *loop, gt_paddr_record *record, guint vcpu_id)
+{
+	gboolean ok = FALSE, masked = vcpu_id < GT_STEP_MASK_VCPUS;
+	x86_registers_t regs = { .cr3 = 426 << 12, .rsp = 0xffffc90000010000ull };
+	vmi_event_t event = { .data = loop, .vcpu_id = vcpu_id, .x86_regs = &regs };
+	vmi_event_t *step;
+	event_response_t response;
+
+	event.interrupt_event.gla = record->va;
+
+	response = gt_breakpoint_cb(loop->vmi, &event);
+	step     = mock_vmi_get_step_event(loop->vmi, vcpu_id);
+
+	if (0 != event.slat_id || !(response & VMI_EVENT_RESPONSE_VMM_PAGETABLE_ID)) {
+		fprintf(stderr, "VCPU %u: breakpoint left the shadow view in place\n", vcpu_id);
+		goto done;
+	}
+
+	if (masked != !!(response & VMI_EVENT_RESPONSE_TOGGLE_SINGLESTEP)
+	 || masked != (NULL == step)) {
+		fprintf(stderr, "VCPU %u: breakpoint did not start one single step\n", vcpu_id);
+		goto done;
+	}
+
+	if (masked) {
+		step = &gt_vcpu_get(loop, vcpu_id)->step_event;
+	}
+
+	step->vcpu_id  = vcpu_id;
+	step->x86_regs = &regs;
+
+	response = gt_singlestep_cb(loop->vmi, step);
+
+	if (step->slat_id != loop->shadow_view) {
+		fprintf(stderr, "VCPU %u: step did not restore the shadow view\n", vcpu_id);
+		goto done;
+	}
+
+	if (masked != !!(response & VMI_EVENT_RESPONSE_TOGGLE_SINGLESTEP)
+	 || NULL != mock_vmi_get_step_event(loop->vmi, vcpu_id)) {
+		fprintf(stderr, "VCPU %u: step did not stop single-stepping\n", vcpu_id);
+		goto done;
+	}
+
+	ok = TRUE;
+
+done:
+	return ok;
+}
+
+int
+main(int argc, char *argv[])
+{
+	int fnval = EXIT_FAILURE;
+	GtLoop *loop;
+	gt_paddr_record *record;
+	const guint vcpus[] = { 0, GT_STEP_MASK_VCPUS - 1, GT_STEP_MASK_VCPUS, TEST_VCPUS - 1 };
+
+	loop = _gt_loop_alloc("test");
+	loop->vmi          = mock_vmi_new(VMI_OS_LINUX);
+	loop->os           = VMI_OS_LINUX;
+	loop->os_functions = &os_functions_linux;
+	loop->shadow_view  = 1;
+
+	mock_vmi_set_num_vcpus(loop->vmi, TEST_VCPUS + 1);
+
+	record             = g_new0(gt_paddr_record, 1);
+	record->va         = TEST_FUNC;
+	record->syscall_cb = test_syscall_cb;
+	record->enabled    = TRUE;
+	record->name       = g_strdup("test_func");
+
+	loop->bp_index      = g_new0(gt_bp_slot, 1ull << GT_BP_INDEX_MIN_BITS);
+	loop->bp_index_bits = GT_BP_INDEX_MIN_BITS;
+	gt_bp_index_insert(loop, record);
+
+	/* The last VCPU which the mock reports stays unknown until it traps. */
+	gt_vcpus_resize(loop, TEST_VCPUS);
+	for (guint id = 0; id < TEST_VCPUS; id++) {
+		if (!gt_register_step_event(loop, id)) {
+			goto done;
+		}
+	}
+
+	loop->steps_enabled = TRUE;
+
+	for (guint i = 0; i < G_N_ELEMENTS(vcpus); i++) {
+		if (!test_step(loop, record, vcpus[i])) {
+			goto done;
+		}
+	}
+
+	if (!test_step(loop, record, TEST_VCPUS)) {
+		goto done;
+	}
+
+	fnval = EXIT_SUCCESS;
+
+done:
+	gt_loop_free(loop);
+	gt_free_paddr_record(record);
+
+	return fnval;
+}
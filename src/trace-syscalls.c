@@ -1,3 +1,7 @@
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
 #include <capstone/capstone.h>
 #include <libvmi/libvmi.h>
 #include <libvmi/events.h>
@@ -5,15 +9,27 @@
 #include <libvmi/libvmi_extra.h>
 #include <glib.h>
 #include <libxl_utils.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
 #include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 
+#include "args.h"
+#include "attach-cache.h"
+#include "deferred.h"
 #include "early-boot.h"
+#include "filter.h"
 #include "guestrace.h"
 #include "guestrace-private.h"
 #include "functions-linux.h"
 #include "functions-windows.h"
+#include "replay.h"
+#include "sampling.h"
+#include "stats.h"
 #include "trace-syscalls.h"
 
 /*
@@ -65,7 +81,10 @@
  * start-up time, guestrace finds the instruction. While servicing each
  * type-one breakpoint, guestrace overwrites the stack so that the return
  * executes the breakpoint instruction. After servicing a type-two breakpoing,
- * guestrace sets RIP to the original return point.
+ * guestrace sets RIP to the original return point. Where the guest provides
+ * more than one such instruction, guestrace reserves each additional one for
+ * a single in-flight system call. A return through one of these identifies
+ * its system call without a table lookup.
  */
 
 /**
@@ -81,6 +100,11 @@
  * facilities available from within a callback through its
  * gt_guest_get_vmi_instance() and gt_guest_get_vmi_event() routines.
  *
+ * A program may monitor several guests at once by creating one #GtLoop per
+ * guest and calling gt_loop_start() on each. Each loop then services its
+ * guest's events on its own thread, so that a slow guest does not stall the
+ * others.
+ *
  * <example>
  * 	<title>Program which uses libguestrace to print open()s and read()s which occur on a Linux guest (error handling and other details omitted)</title>
  * 	<programlisting>
@@ -112,12 +136,6 @@
 /* Intel breakpoint interrupt (INT 3) instruction. */
 uint8_t GT_BREAKPOINT_INST = 0xCC;
 
-/*
- * Handle terminating signals by unsetting gt_running flag. This allows
- * a graceful exit.
- */
-static gboolean gt_running = TRUE;
-
 /*
  * A record which describes a frame. The children of these records (themselves
  * of type gt_paddr_record) describe the physical addresses contained in the
@@ -133,6 +151,15 @@ typedef struct gt_page_record {
 	addr_t      shadow_frame;
 	GHashTable *children;
 	GtLoop     *loop;
+
+	/* Whether read_view traps execution of frame; see gt_loop_set_execute_only(). */
+	gboolean    exec_trapped;
+
+	/* Counters; see GtPageStats. */
+	guint64     mem_rw;
+	guint64     single_steps;
+	guint64     view_switches;
+	guint64     exec_returns;
 } gt_page_record;
 
 /*
@@ -144,310 +171,408 @@ typedef struct gt_page_record {
  * 	Value: gt_paddr_record
  */
 typedef struct gt_paddr_record {
+	addr_t          va;     /* Key in bp_index. */
 	addr_t          offset;
 	GtSyscallFunc   syscall_cb;
 	GtSysretFunc    sysret_cb;
-	gt_page_record *parent;
+	gt_page_record *parent; /* NULL once retired by gt_unset_mem_trap(). */
 	void           *data; /* Optional; passed to syscall_cb. */
+	gboolean        flushes_process_caches; /* Process created/destroyed. */
+	gboolean        enabled;
+	GtFilter       *filter; /* Optional; see gt_loop_set_cb_filter(). */
+	char           *name;   /* Kernel function, for GtSyscallStats. */
+	guint           id;     /* See gt_guest_get_cb_id(). */
+	guint64         calls;
+	guint64         returns;
+
+	/* Optional; see gt_loop_set_sampling(). */
+	gt_sampler     *sampler;
+	gboolean        sampling_disarmed; /* Sampler removed the breakpoint. */
+	guint64         skipped;
+	guint64         disarms;
 } gt_paddr_record;
 
+static void
+gt_free_paddr_record (gpointer data) {
+	gt_paddr_record *paddr_record = data;
+
+	gt_sampler_free(paddr_record->sampler);
+	gt_filter_unref(paddr_record->filter);
+	g_free(paddr_record->name);
+	g_free(paddr_record);
+}
+
 /*
  * Describes the state associated with a system call. This information is
  * stored and later made available while servicing the corresponding
  * system return.
  *
- * Stored in gt_ret_addr_mapping.
- * 	Key:   addr_t (thread_id AKA thread's stack pointer)
- * 	Value: gt_syscall_state
+ * Stored inline in the open-addressed table syscall_states, keyed by
+ * thread_id (AKA thread's stack pointer). A thread_id of zero marks an empty
+ * slot. Since slots move as the table changes, callers must not hold a
+ * pointer to a gt_syscall_state across an insertion or removal.
  */
 typedef struct gt_syscall_state {
 	gt_paddr_record *syscall_paddr_record;
+	GtSysretFunc     sysret_cb; /* As of the call; the record might change. */
 	void            *data;
 	addr_t           thread_id; /* needed for teardown */
 } gt_syscall_state;
 
 /*
- * Restore a stack return pointer; useful to ensure the kernel continues to
- * run after guestrace exit. Otherwise, guestrace's stack manipulation might
- * remain in place, since guestrace might no longer exist at the time of a
- * system-call return.
+ * A type-two breakpoint reserved for a single in-flight system call. A
+ * return through trampoline va identifies its state directly, so servicing
+ * the return requires no lookup in syscall_states. A state.thread_id of
+ * zero marks a free trampoline.
+ */
+typedef struct gt_trampoline {
+	addr_t           va;
+	gt_syscall_state state;
+} gt_trampoline;
+
+/* Maximum number of private trampolines guestrace will use. */
+#define GT_MAX_TRAMPOLINES 64
+
+/*
+ * Number of concurrent system calls per VCPU for which syscall_states
+ * initially has room. The count covers threads blocked in the kernel, not
+ * merely those running, hence it exceeds one.
+ */
+#define GT_SYSCALL_STATES_PER_VCPU 128
+
+/*
+ * Describes a guest process as last observed by guestrace. The DTB allows
+ * guestrace to detect a stale record after the kernel reuses a PID or after
+ * an execve replaces the process's address space.
+ *
+ * Stored in gt_process_names.
+ * 	Key:   gt_pid_t
+ * 	Value: gt_process_name
  */
+typedef struct gt_process_name {
+	addr_t  dtb;
+	char   *name;
+} gt_process_name;
+
 static void
-gt_restore_return_addr (gpointer data)
+gt_destroy_process_name (gpointer data)
 {
-	status_t status;
-	gt_syscall_state *sys_state = data;
-	GtLoop *loop = sys_state->syscall_paddr_record->parent->loop;
+	gt_process_name *process_name = data;
 
-	if (gt_running) {
-		/*
-		 * Save time: no need to restore stack if guestrace remains
-		 * attached. In this case, we will return through the
-		 * trampoline by setting RIP.
-		 */
+	g_free(process_name->name);
+	g_free(process_name);
+}
+
+/*
+ * Forget all cached process information. Guestrace calls this after the guest
+ * creates or destroys a process, since either might change the relationship
+ * between PIDs, DTBs, and names; in particular, a new process might reuse
+ * the DTB of one which has died. See struct os_functions.
+ */
+static void
+gt_flush_process_caches(GtLoop *loop)
+{
+	g_hash_table_remove_all(loop->gt_process_names);
+	g_hash_table_remove_all(loop->gt_dtb_pids);
+	vmi_pidcache_flush(loop->vmi);
+}
+
+/*
+ * Return the PID of the process which owns dtb. This consults gt_dtb_pids
+ * first, and it walks the guest's process list only on a miss. The cache
+ * ignores the PCID in dtb, so that each process fills one slot.
+ */
+static gt_pid_t
+gt_dtb_to_pid(GtLoop *loop, addr_t dtb)
+{
+	gpointer value;
+	gt_pid_t pid;
+
+	dtb &= ~GT_CR3_PCID_MASK;
+
+	if (g_hash_table_lookup_extended(loop->gt_dtb_pids,
+	                                 GSIZE_TO_POINTER(dtb),
+	                                 NULL,
+	                                &value)) {
+		pid = GPOINTER_TO_INT(value);
 		goto done;
 	}
 
-	addr_t pa = vmi_translate_kv2p(loop->vmi, sys_state->thread_id);
-	if (0 == pa) {
-		fprintf(stderr, "error restoring stack; guest will likely fail\n");
+	pid = vmi_dtb_to_pid(loop->vmi, dtb);
+	if (-1 == pid) {
+		/* Do not cache failure; the process might not yet be listed. */
 		goto done;
 	}
 
-	status = vmi_write_64_pa(loop->vmi, pa, &loop->return_addr);
-	if (VMI_SUCCESS != status) {
-		fprintf(stderr, "error restoring stack; guest will likely fail\n");
+	g_hash_table_insert(loop->gt_dtb_pids,
+	                    GSIZE_TO_POINTER(dtb),
+	                    GINT_TO_POINTER(pid));
+
+done:
+	return pid;
+}
+
+/*
+ * Lower the guest's memory limit by count pages, once gt_allocate_shadow_frames()
+ * has raised it and the pages have gone back to Xen.
+ */
+static void
+gt_lower_mem_size (GtLoop *loop, unsigned long count)
+{
+	int rc;
+	uint64_t proposed_mem_size = loop->curr_mem_size - count * GT_PAGE_SIZE;
+
+	rc = xc_domain_setmaxmem(loop->xch, loop->domid, proposed_mem_size);
+	if (rc < 0) {
+		fprintf(stderr,
+		       "failed to decrease memory size on guest to %lx\n",
+		        proposed_mem_size);
 		goto done;
 	}
 
+	loop->curr_mem_size = proposed_mem_size;
+
 done:
-	g_free(sys_state);
+	return;
 }
 
+/*
+ * Undo the work of gt_setup_mem_trap() on a frame: point frame back to its
+ * original page in the shadow view, forget about shadow, and return it to
+ * Xen.
+ */
 static void
-gt_destroy_page_record (gpointer data) {
+gt_release_shadow_frame (GtLoop *loop, addr_t frame, xen_pfn_t shadow) {
 	status_t status;
+
+	status = vmi_slat_change_gfn(loop->vmi, loop->shadow_view, frame, ~0);
+	if (VMI_SUCCESS != status) {
+		fprintf(stderr, "failed to update shadow view\n");
+	}
+
+	g_hash_table_remove(loop->gt_page_translation, GSIZE_TO_POINTER(frame));
+
+	xc_domain_decrease_reservation_exact(loop->xch, loop->domid, 1, 0, &shadow);
+	gt_lower_mem_size(loop, 1);
+}
+
+static void
+gt_destroy_page_record (gpointer data) {
 	gt_page_record *page_record = data;
 
 	g_hash_table_destroy(page_record->children);
 
+	/* gt_release_shadow_frames() has already released every frame. */
+	if (0 == page_record->loop->shadow_view) {
+		goto done;
+	}
+
 	/* Stop monitoring this page. */
 	vmi_set_mem_event(page_record->loop->vmi,
 	                  page_record->frame,
 	                  VMI_MEMACCESS_N,
 	                  page_record->loop->shadow_view);
 
-	status = vmi_slat_change_gfn(page_record->loop->vmi,
-				     page_record->loop->shadow_view,
-				     page_record->shadow_frame,
-				    ~0);
-	if (VMI_SUCCESS != status) {
-		fprintf(stderr, "failed to update shadow view\n");
+	if (page_record->exec_trapped) {
+		vmi_set_mem_event(page_record->loop->vmi,
+		                  page_record->frame,
+		                  VMI_MEMACCESS_N,
+		                  page_record->loop->read_view);
 	}
 
-	xc_domain_decrease_reservation_exact(page_record->loop->xch,
-	                                     page_record->loop->domid,
-	                                     1, 0,
-	                                    &page_record->shadow_frame);
+	gt_release_shadow_frame(page_record->loop,
+	                        page_record->frame,
+	                        page_record->shadow_frame);
 
+done:
 	g_free(page_record);
 }
 
 /*
- * Callback after a step event on any VCPU.
+ * Release the shadow frame of every page record at once as loop detaches:
+ * destroying the shadow view drops each remapping and access setting in one
+ * call, and one hypercall then returns the frames to Xen, where
+ * gt_destroy_page_record() would make three hypercalls for each page. The
+ * VCPUs must have left the view. If the view survives, the page records
+ * release their frames one by one as they are destroyed.
  */
-static event_response_t
-gt_singlestep_cb(vmi_instance_t vmi, vmi_event_t *event) {
-	GtLoop *loop = event->data;
-
-	/* Resume use of shadow SLAT. */
-	event->slat_id = loop->shadow_view;
+static void
+gt_release_shadow_frames(GtLoop *loop)
+{
+	GHashTableIter iter;
+	gpointer data;
+	GArray *frames;
+	status_t status;
 
-	/* Turn off single-step and switch slat_id. */
-	return VMI_EVENT_RESPONSE_TOGGLE_SINGLESTEP
-	     | VMI_EVENT_RESPONSE_VMM_PAGETABLE_ID;
-}
+	frames = g_array_sized_new(FALSE,
+	                           FALSE,
+	                           sizeof (xen_pfn_t),
+	                           g_hash_table_size(loop->gt_page_record_collection));
 
-/*
- * Preemptively create the step events needed for each VCPU so we don't have to
- * create a new event each time we want to single-step.
- */
-static bool
-gt_set_up_step_events (GtLoop *loop)
-{
-	bool ok = false;
+	g_hash_table_iter_init(&iter, loop->gt_page_record_collection);
+	while (g_hash_table_iter_next(&iter, NULL, &data)) {
+		gt_page_record *page_record = data;
+		xen_pfn_t shadow = page_record->shadow_frame;
 
-	int vcpus = vmi_get_num_vcpus(loop->vmi);
-	if (0 == vcpus) {
-		fprintf(stderr, "failed to get number of VCPUs\n");
-		goto done;
+		g_array_append_val(frames, shadow);
 	}
 
-	if (vcpus > _GT_MAX_VCPUS) {
-		fprintf(stderr, "guest has more VCPUs than supported\n");
+	status = vmi_slat_destroy(loop->vmi, loop->shadow_view);
+	if (VMI_SUCCESS != status) {
+		fprintf(stderr, "failed to destroy shadow view\n");
 		goto done;
 	}
 
-	for (int vcpu = 0; vcpu < vcpus; vcpu++) {
-		SETUP_SINGLESTEP_EVENT(&(loop->step_event[vcpu]),
-		                       1u << vcpu,
-		                       gt_singlestep_cb,
-		                       0);
-		loop->step_event[vcpu].data = loop;
+	loop->shadow_view = 0;
+	g_hash_table_remove_all(loop->gt_page_translation);
 
-		if (VMI_SUCCESS != vmi_register_event(loop->vmi,
-		                                     &loop->step_event[vcpu])) {
-			fprintf(stderr,
-			       "register single-step event on VCPU failed %d\n",
-			        vcpu);
-			goto done;
-		}
+	if (0 != frames->len) {
+		xc_domain_decrease_reservation_exact(loop->xch,
+		                                     loop->domid,
+		                                     frames->len,
+		                                     0,
+		                                     (xen_pfn_t *) frames->data);
+		gt_lower_mem_size(loop, frames->len);
 	}
 
-	ok = true;
-
 done:
-	return ok;
+	g_array_free(frames, TRUE);
 }
 
-/*
- * Return the paddr_record associated with the given physical address.
- *
- * First obtain the page record associated with the physical address's
- * page, and then obtain the child within that record which is associated
- * with the physical address. Recall that a given page might contain
- * multiple breakpoints.
- */
-static gt_paddr_record *
-gt_paddr_record_from_pa(GtLoop *loop, addr_t pa) {
-	gt_paddr_record *paddr_record = NULL;
-	gt_page_record  *page_record  = NULL;
+static event_response_t
+gt_singlestep_cb(vmi_instance_t vmi, vmi_event_t *event);
 
-	addr_t frame  = pa >> GT_PAGE_OFFSET_BITS;
-	addr_t offset = pa  % GT_PAGE_SIZE;
-	addr_t shadow = (addr_t)g_hash_table_lookup(loop->gt_page_translation,
-	                                            GSIZE_TO_POINTER(frame));
-	if (0 == shadow) {
+/* Have libvmi deliver vcpu's single steps to gt_singlestep_cb(). */
+static gboolean
+gt_register_step_event(GtLoop *loop, guint id)
+{
+	gt_vcpu *vcpu = loop->vcpus[id];
+	status_t status;
+
+	if (vcpu->step_registered) {
 		goto done;
 	}
 
-	page_record = g_hash_table_lookup(loop->gt_page_record_collection,
-	                                  GSIZE_TO_POINTER(shadow));
-	if (NULL == page_record) {
-		goto done;
+	/*
+	 * A step event's VCPU mask holds 32 bits. Later VCPUs get an event
+	 * without a mask, which gt_step_begin() hands to libvmi each time it
+	 * steps the VCPU.
+	 */
+	SETUP_SINGLESTEP_EVENT(&vcpu->step_event,
+	                       id < GT_STEP_MASK_VCPUS ? 1u << id : 0,
+	                       gt_singlestep_cb,
+	                       0);
+	vcpu->step_event.data = loop;
+
+	if (id < GT_STEP_MASK_VCPUS) {
+		status = vmi_register_event(loop->vmi, &vcpu->step_event);
+		if (VMI_SUCCESS != status) {
+			fprintf(stderr, "register single-step event on VCPU failed %u\n", id);
+			goto done;
+		}
 	}
 
-	paddr_record = g_hash_table_lookup(page_record->children,
-	                                   GSIZE_TO_POINTER(offset));
+	vcpu->step_registered = TRUE;
 
 done:
-	return paddr_record;
-}
-
-/* Return the paddr_record associated with the given virtual address. */
-static gt_paddr_record *
-gt_paddr_record_from_va(GtLoop *loop, addr_t va) {
-	return gt_paddr_record_from_pa(loop, vmi_translate_kv2p(loop->vmi, va));
-}
-
-/**
- * gt_guest_free_syscall_state:
- * @state: a pointer to a #GtGuestState.
- * @thread_id: the thread ID associated with the syscall to free.
- *
- * Frees the object which the guestrace event loop would have allocated
- * when processing the system call associated with @thread_id. This is useful
- * for system calls that never return (unless there is an error) such as execve.
- * The application must first free the object pointed to by the @data
- * argument to the #GtSyscallFunc before calling this function. The
- * application should not call this function if the guestrace event loop
- * will call #GtSysretFunc.
- */
-void
-gt_guest_free_syscall_state(GtGuestState *state, gt_tid_t thread_id)
-{
-	g_hash_table_remove(state->loop->gt_ret_addr_mapping,
-			    GSIZE_TO_POINTER(thread_id));
+	return vcpu->step_registered;
 }
 
 /*
- * Service a triggered breakpoint. Restore the original page table for one
- * single-step iteration and invoke the system call or return callback.
- *
- * In the case of a system call, enable the syscall return breakpoint.
- *
- * In the case of a system return, disable the syscall return breakpoint until
- * the next system call enables it.
+ * Ensure loop has state for count VCPUs. Each gt_vcpu has its own aligned
+ * allocation, so that growing loop->vcpus leaves them in place.
  */
-static event_response_t
-gt_breakpoint_cb(vmi_instance_t vmi, vmi_event_t *event) {
-	event_response_t response = VMI_EVENT_RESPONSE_NONE;
+static void
+gt_vcpus_resize(GtLoop *loop, guint count)
+{
+	if (count <= loop->vcpu_count) {
+		goto done;
+	}
 
-	GtLoop *loop = event->data;
-	event->interrupt_event.reinject = 0;
+	loop->vcpus = g_renew(gt_vcpu *, loop->vcpus, count);
 
-	if (event->interrupt_event.gla != loop->trampoline_addr) {
-		/* Type-one breakpoint (system call). */
-		status_t status;
-		addr_t thread_id, return_loc;
-		gt_paddr_record *record;
-		gt_syscall_state *state;
+	for (guint id = loop->vcpu_count; id < count; id++) {
+		void *vcpu;
 
-		/* Lookup record corresponding to breakpoint address. */
-		record = gt_paddr_record_from_va(loop,
-		                                 event->interrupt_event.gla);
-		if (NULL == record) {
-			/* Assume we didn't emplace interrupt. */
-			event->interrupt_event.reinject = 1;
-			/* TODO: Ensure this does the right thing: */
-			goto done;
+		if (0 != posix_memalign(&vcpu, GT_CACHE_LINE_SIZE, sizeof(gt_vcpu))) {
+			g_error("failed to allocate state of VCPU %u", id);
 		}
 
-		/* Set VCPUs SLAT to use original for one step. */
-		event->slat_id = 0;
-
-		/* Turn on single-step and switch slat_id after return. */
-		response = VMI_EVENT_RESPONSE_TOGGLE_SINGLESTEP
-		         | VMI_EVENT_RESPONSE_VMM_PAGETABLE_ID;
-
-		/*
-		 * Testing indicated this was necessary to get vaddr
-		 * translations to consistently work in a GtSyscallFunc.
-		 */
-		vmi_pidcache_flush(loop->vmi);
-
-		thread_id = return_loc = event->x86_regs->rsp;
+		memset(vcpu, 0, sizeof(gt_vcpu));
+		loop->vcpus[id]  = vcpu;
+		loop->vcpu_count = id + 1;
 
-		addr_t return_addr = 0;
-		status = vmi_read_64_va(vmi, return_loc, 0, &return_addr);
-		if (VMI_SUCCESS != status || return_addr != loop->return_addr) {
-			/* Return pointer not as expected. */
-			goto done;
+		/* A VCPU which appeared after start-up needs its step event. */
+		if (loop->steps_enabled) {
+			gt_register_step_event(loop, id);
 		}
+	}
 
-		gt_pid_t pid = vmi_dtb_to_pid(vmi, event->x86_regs->cr3);
+done:
+	return;
+}
 
-		state                       = g_new0(gt_syscall_state, 1);
-		state->syscall_paddr_record = record;
-		state->thread_id            = thread_id;
+static void
+gt_vcpus_free(GtLoop *loop)
+{
+	for (guint id = 0; id < loop->vcpu_count; id++) {
+		free(loop->vcpus[id]);
+	}
 
-		/* Invoke system-call callback in record. */
-		state->data          = record->syscall_cb(&(GtGuestState) { loop, vmi, event },
-		                                          pid,
-		                                          thread_id,
-		                                          record->data);
+	g_free(loop->vcpus);
+	loop->vcpus      = NULL;
+	loop->vcpu_count = 0;
+}
 
-		/* Record system-call state. */
-		g_hash_table_insert(loop->gt_ret_addr_mapping,
-		                    GSIZE_TO_POINTER(thread_id),
-		                    state);
+/* Return the state of VCPU id, creating it if the VCPU is new (hot-plugged). */
+static inline gt_vcpu *
+gt_vcpu_get(GtLoop *loop, guint id)
+{
+	if (G_UNLIKELY(id >= loop->vcpu_count)) {
+		gt_vcpus_resize(loop, id + 1);
+	}
 
-		/* Overwrite stack to return to trampoline. */
-		vmi_write_64_va(vmi, return_loc, 0, &loop->trampoline_addr);
-	} else {
-		/* Type-two breakpoint (system return). */
-		gt_syscall_state *state;
-		addr_t thread_id = event->x86_regs->rsp - loop->return_addr_width;
+	return loop->vcpus[id];
+}
 
-		state = g_hash_table_lookup(loop->gt_ret_addr_mapping,
-		                            GSIZE_TO_POINTER(thread_id));
+/* Return the counters of the VCPU which caused event. */
+static inline GtVcpuStats *
+gt_vcpu_stats(GtLoop *loop, vmi_event_t *event)
+{
+	return &gt_vcpu_get(loop, event->vcpu_id)->stats;
+}
 
-		if (NULL != state) {
-			gt_pid_t pid = vmi_dtb_to_pid(vmi, event->x86_regs->cr3);
+/* Return the counters of VCPU vcpu_id, for modules such as replay.c. */
+GtVcpuStats *
+_gt_loop_get_vcpu_stats(GtLoop *loop, guint vcpu_id)
+{
+	return &gt_vcpu_get(loop, vcpu_id)->stats;
+}
 
-			state->syscall_paddr_record->sysret_cb(&(GtGuestState) { loop, vmi, event },
-			                                       pid,
-			                                       thread_id,
-			                                       state->data);
+/*
+ * Return the response which single-steps the VCPU which caused event. libvmi
+ * toggles stepping through the response only on the VCPUs which a step
+ * event's mask can name; later VCPUs start stepping through
+ * vmi_toggle_single_step_vcpu(), and gt_singlestep_cb() stops them the
+ * same way.
+ */
+static event_response_t
+gt_step_begin(GtLoop *loop, vmi_event_t *event)
+{
+	event_response_t response = VMI_EVENT_RESPONSE_TOGGLE_SINGLESTEP;
+	status_t status;
+	gt_vcpu *vcpu;
 
-			vmi_set_vcpureg(vmi, loop->return_addr, RIP, event->vcpu_id);
+	if (G_LIKELY(event->vcpu_id < GT_STEP_MASK_VCPUS)) {
+		goto done;
+	}
 
-			/*
-			 * This will free our gt_syscall_state object, but
-			 * sysret_cb must have freed state->data.
-			 */
-			gt_guest_free_syscall_state(&(GtGuestState) { loop, vmi, event }, thread_id);
-		}
+	response = VMI_EVENT_RESPONSE_NONE;
+	vcpu     = gt_vcpu_get(loop, event->vcpu_id);
+
+	status = vmi_toggle_single_step_vcpu(loop->vmi, &vcpu->step_event, event->vcpu_id, true);
+	if (VMI_SUCCESS != status) {
+		fprintf(stderr, "failed to single-step VCPU %u\n", event->vcpu_id);
 	}
 
 done:
@@ -455,839 +580,3256 @@ done:
 }
 
 /*
- * Callback invoked on a R/W of a monitored page (likely Windows kernel patch
- * protection). Switch the VCPU's SLAT to its original, step once, switch SLAT
- * back.
+ * Callback after a step event on any VCPU.
  */
 static event_response_t
-gt_mem_rw_cb (vmi_instance_t vmi, vmi_event_t *event) {
-	/* Switch back to original SLAT for one step. */
-	event->slat_id = 0;
+gt_singlestep_cb(vmi_instance_t vmi, vmi_event_t *event) {
+	GtLoop *loop = event->data;
+	event_response_t response = VMI_EVENT_RESPONSE_VMM_PAGETABLE_ID;
+	status_t status;
+
+	g_rec_mutex_lock(&loop->lock);
 
-	return VMI_EVENT_RESPONSE_TOGGLE_SINGLESTEP
-	     | VMI_EVENT_RESPONSE_VMM_PAGETABLE_ID;
+	gt_vcpu_stats(loop, event)->single_steps++;
+
+	/* Resume use of shadow SLAT. */
+	event->slat_id = loop->shadow_view;
+
+	/* Turn off single-step, as gt_step_begin() turned it on. */
+	if (G_LIKELY(event->vcpu_id < GT_STEP_MASK_VCPUS)) {
+		response |= VMI_EVENT_RESPONSE_TOGGLE_SINGLESTEP;
+	} else {
+		status = vmi_toggle_single_step_vcpu(vmi, event, event->vcpu_id, false);
+		if (VMI_SUCCESS != status) {
+			fprintf(stderr, "failed to stop single-stepping VCPU %u\n", event->vcpu_id);
+		}
+	}
+
+	g_rec_mutex_unlock(&loop->lock);
+
+	return response;
 }
 
 /*
- * Setup our global interrupt to catch any interrupts on any pages.
+ * Preemptively create the step events needed for each VCPU so we don't have to
+ * create a new event each time we want to single-step.
  */
 static bool
-gt_set_up_generic_events (GtLoop *loop) {
-	bool ok = false;
-	status_t status;
-
-	SETUP_INTERRUPT_EVENT(&loop->breakpoint_event, 0, gt_breakpoint_cb);
-	loop->breakpoint_event.data = loop;
+gt_set_up_step_events (GtLoop *loop)
+{
+	bool ok = false;
 
-	status = vmi_register_event(loop->vmi, &loop->breakpoint_event);
-	if (VMI_SUCCESS != status) {
-		fprintf(stderr, "Failed to setup interrupt event\n");
+	guint vcpus = vmi_get_num_vcpus(loop->vmi);
+	if (0 == vcpus) {
+		fprintf(stderr, "failed to get number of VCPUs\n");
 		goto done;
 	}
 
-	SETUP_MEM_EVENT(&loop->memory_event,
-	                ~0ULL,
-	                 VMI_MEMACCESS_RW,
-	                 gt_mem_rw_cb,
-	                 1);
-
-	loop->memory_event.data = loop;
+	gt_vcpus_resize(loop, vcpus);
 
-	status = vmi_register_event(loop->vmi, &loop->memory_event);
-	if (VMI_SUCCESS != status) {
-		fprintf(stderr, "failed to setup memory event\n");
-		goto done;
+	for (guint vcpu = 0; vcpu < loop->vcpu_count; vcpu++) {
+		if (!gt_register_step_event(loop, vcpu)) {
+			goto done;
+		}
 	}
 
+	/* VCPUs which appear later register as their first event arrives. */
+	loop->steps_enabled = TRUE;
+
 	ok = true;
 
 done:
 	return ok;
 }
 
-/* Search the kernel code address space for an existing int 3 instruction. */
-addr_t
-gt_find_trampoline_addr (GtLoop *loop)
+/* Minimum number of slots in bp_index. */
+#define GT_BP_INDEX_MIN_BITS 4
+
+/* Map a breakpoint's virtual address to its home slot in bp_index. */
+static inline addr_t
+gt_bp_index_hash(addr_t va, uint8_t bits)
 {
-	addr_t trampoline_addr = 0;
-	status_t status;
-	addr_t lstar = 0;
-	uint8_t code[GT_PAGE_SIZE] = { 0 }; /* Assume CALL is within first page. */
+	/* Fibonacci hashing; kernel functions are often 16-byte aligned. */
+	return (va * 0x9E3779B97F4A7C15ull) >> (64 - bits);
+}
 
-	/* LSTAR should be constant across all VCPUs */
-	status = vmi_get_vcpureg(loop->vmi, &lstar, MSR_LSTAR, 0);
-	if (VMI_SUCCESS != status) {
-		fprintf(stderr, "failed to get MSR_LSTAR address\n");
-		goto done;
+static void
+gt_bp_index_insert(GtLoop *loop, gt_paddr_record *record)
+{
+	addr_t mask = (1ull << loop->bp_index_bits) - 1;
+	addr_t slot = gt_bp_index_hash(record->va, loop->bp_index_bits);
+
+	while (0 != loop->bp_index[slot].va && record->va != loop->bp_index[slot].va) {
+		slot = (slot + 1) & mask;
 	}
 
-	g_assert(loop->lstar_addr == lstar);
+	loop->bp_index[slot].va     = record->va;
+	loop->bp_index[slot].record = record;
+}
 
-	addr_t lstar_p = vmi_translate_kv2p(loop->vmi, lstar);
-	if (0 == lstar_p) {
-		fprintf(stderr, "failed to translate virtual LSTAR to physical address");
-		goto done;
+/*
+ * Rebuild bp_index from gt_page_record_collection. The table remains at most
+ * half full, so a lookup generally touches a single cache line.
+ */
+static void
+gt_bp_index_rebuild(GtLoop *loop)
+{
+	GHashTableIter page_iter;
+	gpointer page_value;
+	guint count = 0;
+	uint8_t bits = GT_BP_INDEX_MIN_BITS;
+
+	g_hash_table_iter_init(&page_iter, loop->gt_page_record_collection);
+	while (g_hash_table_iter_next(&page_iter, NULL, &page_value)) {
+		gt_page_record *page_record = page_value;
+		count += g_hash_table_size(page_record->children);
 	}
 
-	/* Read kernel instructions into code. */
-	status = vmi_read_pa(loop->vmi, lstar_p, code, sizeof(code));
-	if (status < GT_PAGE_SIZE) {
-		fprintf(stderr, "failed to read instructions from 0x%lx.\n",
-		                 lstar_p);
+	while ((1ull << bits) < 2ull * count) {
+		bits++;
+	}
+
+	g_free(loop->bp_index);
+	loop->bp_index      = g_new0(gt_bp_slot, 1ull << bits);
+	loop->bp_index_bits = bits;
+
+	g_hash_table_iter_init(&page_iter, loop->gt_page_record_collection);
+	while (g_hash_table_iter_next(&page_iter, NULL, &page_value)) {
+		GHashTableIter paddr_iter;
+		gpointer paddr_value;
+		gt_page_record *page_record = page_value;
+
+		g_hash_table_iter_init(&paddr_iter, page_record->children);
+		while (g_hash_table_iter_next(&paddr_iter, NULL, &paddr_value)) {
+			gt_bp_index_insert(loop, paddr_value);
+		}
+	}
+}
+
+/*
+ * Return the paddr_record associated with the given virtual address, or NULL
+ * if guestrace did not emplace a breakpoint there.
+ */
+static gt_paddr_record *
+gt_paddr_record_from_va(GtLoop *loop, addr_t va) {
+	gt_paddr_record *paddr_record = NULL;
+	addr_t mask, slot;
+
+	if (NULL == loop->bp_index || 0 == va) {
 		goto done;
 	}
 
-	/* Look for int 3. */
-	for (int curr_inst = 0; curr_inst < GT_PAGE_SIZE; curr_inst++) {
-		if (code[curr_inst] == GT_BREAKPOINT_INST) {
-			trampoline_addr = lstar + curr_inst;
+	mask = (1ull << loop->bp_index_bits) - 1;
+	slot = gt_bp_index_hash(va, loop->bp_index_bits);
+
+	while (0 != loop->bp_index[slot].va) {
+		if (va == loop->bp_index[slot].va) {
+			paddr_record = loop->bp_index[slot].record;
 			break;
 		}
+
+		slot = (slot + 1) & mask;
 	}
 
 done:
-	return trampoline_addr;
+	return paddr_record;
 }
 
-/**
- * gt_loop_new:
- * @guest_name: the name of a running guest virtual machine.
- *
- * Creates a new #GtLoop structure.
- *
- * Returns: a new #GtLoop.
- **/
-GtLoop *gt_loop_new(const char *guest_name)
+static gt_syscall_state *
+gt_syscall_state_slot(GtLoop *loop, addr_t thread_id)
 {
-	int i;
-	GtLoop *loop;
-	int rc;
-	status_t status = VMI_FAILURE;
+	addr_t mask = (1ull << loop->syscall_states_bits) - 1;
+	addr_t slot = gt_bp_index_hash(thread_id, loop->syscall_states_bits);
 
-	loop = g_new0(GtLoop, 1);
-
-	loop->g_main_loop = g_main_loop_new(NULL, true);
-	loop->guest_name = guest_name;
+	while (0 != loop->syscall_states[slot].thread_id
+	    && thread_id != loop->syscall_states[slot].thread_id) {
+		slot = (slot + 1) & mask;
+	}
 
-	/* Initialize the libvmi library. */
-	for (i = 0; i < 300; i++) {
-		status = vmi_init(&loop->vmi,
-				   VMI_XEN | VMI_INIT_COMPLETE | VMI_INIT_EVENTS,
-				   guest_name);
+	return &loop->syscall_states[slot];
+}
 
-		if (VMI_SUCCESS == status) {
-			break;
-		}
+/*
+ * Size syscall_states to hold at least capacity in-flight system calls at a
+ * load factor of one half, moving any existing entries.
+ */
+static void
+gt_syscall_states_resize(GtLoop *loop, guint capacity)
+{
+	gt_syscall_state *old = loop->syscall_states;
+	addr_t old_size = NULL == old ? 0 : 1ull << loop->syscall_states_bits;
+	uint8_t bits = 4;
 
-		usleep(100000);
+	while ((1ull << bits) < 2ull * capacity) {
+		bits++;
 	}
 
-	/* Did vmi_init fail too many times above? */
-	if (VMI_SUCCESS != status) {
-		fprintf(stderr, "failed to init LibVMI library.\n");
-		goto done;
+	loop->syscall_states      = g_new0(gt_syscall_state, 1ull << bits);
+	loop->syscall_states_bits = bits;
+
+	for (addr_t i = 0; i < old_size; i++) {
+		if (0 != old[i].thread_id) {
+			*gt_syscall_state_slot(loop, old[i].thread_id) = old[i];
+		}
 	}
 
-	loop->gt_page_translation = g_hash_table_new(NULL, NULL);
-	loop->gt_page_record_collection = g_hash_table_new_full(NULL,
-	                                                        NULL,
-	                                                        NULL,
-	                                                        gt_destroy_page_record);
-	loop->gt_ret_addr_mapping = g_hash_table_new_full(NULL,
-	                                                  NULL,
-	                                                  NULL,
-	                                                  gt_restore_return_addr);
+	g_free(old);
+}
 
-	vmi_pause_vm(loop->vmi);
+static gt_syscall_state *
+gt_syscall_state_lookup(GtLoop *loop, addr_t thread_id)
+{
+	gt_syscall_state *state = gt_syscall_state_slot(loop, thread_id);
 
-	loop->os = vmi_get_ostype(loop->vmi);
-	switch (loop->os) {
-	case VMI_OS_LINUX:
-		loop->os_functions = &os_functions_linux;
-		break;
-	case VMI_OS_WINDOWS:
-		loop->os_functions = &os_functions_windows;
-		break;
-	default:
-		fprintf(stderr, "unknown guest operating system\n");
-		status = VMI_FAILURE;
-		goto done;
-	}
+	return 0 == state->thread_id ? NULL : state;
+}
 
-	loop->return_addr_width = vmi_get_address_width(loop->vmi);
+/*
+ * Return the slot which will hold the state of the system call made by
+ * thread_id. Allocates only when the number of in-flight system calls first
+ * exceeds the capacity of the table.
+ */
+static gt_syscall_state *
+gt_syscall_state_insert(GtLoop *loop, addr_t thread_id)
+{
+	gt_syscall_state *state;
 
-	loop->xch = xc_interface_open(0, 0, 0);
-	if (NULL == loop->xch) {
-		fprintf(stderr, "failed to create xc interface\n");
-                status = VMI_FAILURE;
-		goto done;
+	if (2 * (loop->syscall_states_count + 1) > 1ull << loop->syscall_states_bits) {
+		gt_syscall_states_resize(loop, 2 * loop->syscall_states_count);
 	}
 
-	rc = libxl_ctx_alloc(&loop->ctx, LIBXL_VERSION, 0, NULL);
-	if (0 != rc) {
-		fprintf(stderr, "failed to create libxl context\n");
-                status = VMI_FAILURE;
-		goto done;
+	state = gt_syscall_state_slot(loop, thread_id);
+	if (0 == state->thread_id) {
+		loop->syscall_states_count++;
 	}
 
-	loop->domid = ~0u;
-	rc = libxl_name_to_domid(loop->ctx, guest_name, &loop->domid);
-	if (0 != rc || ~0u == loop->domid) {
-		fprintf(stderr, "failed to translate guest name to dom. ID\n");
-                status = VMI_FAILURE;
-		goto done;
-	}
+	state->thread_id = thread_id;
 
-	loop->curr_mem_size = loop->init_mem_size = vmi_get_memsize(loop->vmi);
-	if (0 == loop->init_mem_size) {
-		fprintf(stderr, "failed to get guest memory size\n");
-                status = VMI_FAILURE;
-		goto done;
-	}
+	return state;
+}
 
-	status = vmi_slat_set_domain_state(loop->vmi, TRUE);
-	if (VMI_SUCCESS != status) {
-		fprintf(stderr, "failed to enable slat/altp2m on guest\n");
-		goto done;
-	}
+/*
+ * Empty the slot of thread_id, and then shift any later members of its probe
+ * sequence back so that lookups need no tombstones.
+ */
+static void
+gt_syscall_state_remove(GtLoop *loop, addr_t thread_id)
+{
+	addr_t mask = (1ull << loop->syscall_states_bits) - 1;
+	gt_syscall_state *state = gt_syscall_state_slot(loop, thread_id);
+	addr_t hole, slot;
 
-	status = vmi_slat_create(loop->vmi, &loop->shadow_view);
-	if (VMI_SUCCESS != status) {
-		fprintf(stderr, "failed to enable shadow view\n");
+	if (0 == state->thread_id) {
 		goto done;
 	}
 
-	vmi_resume_vm(loop->vmi);
+	hole = slot = state - loop->syscall_states;
 
-done:
-	if (VMI_SUCCESS != status) {
-		gt_loop_free(loop);
-		loop = NULL;
+	while (TRUE) {
+		slot = (slot + 1) & mask;
+		if (0 == loop->syscall_states[slot].thread_id) {
+			break;
+		}
+
+		addr_t home = gt_bp_index_hash(loop->syscall_states[slot].thread_id,
+		                               loop->syscall_states_bits);
+
+		/* Move entry only if its home does not lie in (hole, slot]. */
+		if (((slot - home) & mask) >= ((slot - hole) & mask)) {
+			loop->syscall_states[hole] = loop->syscall_states[slot];
+			hole = slot;
+		}
 	}
 
-	return loop;
+	loop->syscall_states[hole] = (gt_syscall_state) { 0 };
+	loop->syscall_states_count--;
+
+done:
+	return;
 }
 
-/**
- * gt_loop_get_ostype:
- * @loop: a #GtLoop.
- *
- * Returns: the OS type of #GtLoop.
- **/
-GtOSType
-gt_loop_get_ostype(GtLoop *loop)
+/*
+ * Determine whether the system call which claimed trampoline might still
+ * return through it. A call which never returns, such as exit, leaves its
+ * trampoline claimed, but the thread's stack no longer points to the
+ * trampoline once the kernel reuses it.
+ */
+static gboolean
+gt_trampoline_is_live(GtLoop *loop, gt_trampoline *trampoline)
 {
-	switch (loop->os) {
-	case VMI_OS_LINUX:
-		return GT_OS_LINUX;
-	case VMI_OS_WINDOWS:
-		return GT_OS_WINDOWS;
-	default:
-		return GT_OS_UNKNOWN;
-	}
+	status_t status;
+	addr_t return_addr = 0;
+
+	status = vmi_read_64_va(loop->vmi, trampoline->state.thread_id, 0, &return_addr);
+
+	return VMI_SUCCESS == status && return_addr == trampoline->va;
 }
 
- /**
- * gt_loop_get_guest_name:
- * @loop: a #GtLoop.
- *
- * Returns: the name of the guest to which #GtLoop has attached. The #GtLoop
- * maintains ownership of the string. Thus the returned string must not be
- * freed by the caller.
- **/
-const char *
-gt_loop_get_guest_name(GtLoop *loop)
+/*
+ * Return the trampoline at va, or NULL if va is not the address of a private
+ * trampoline.
+ */
+static gt_trampoline *
+gt_trampoline_from_va(GtLoop *loop, addr_t va)
 {
-	return loop->guest_name;
+	gt_trampoline *trampoline = NULL;
+	addr_t offset = va - loop->lstar_addr;
+
+	if (NULL == loop->trampoline_offsets || offset >= GT_PAGE_SIZE) {
+		goto done;
+	}
+
+	if (0 != loop->trampoline_offsets[offset]) {
+		trampoline = &loop->trampolines[loop->trampoline_offsets[offset] - 1];
+	}
+
+done:
+	return trampoline;
 }
 
-/**
- * gt_loop_get_vmi_instance:
- * @loop: a pointer to a #GtLoop.
- *
- * Returns the vmi_instance_t associated with @loop. Refer to the libvmi
- * documentation for a description of vmi_instance_t.
- */
-vmi_instance_t
-gt_loop_get_vmi_instance(GtLoop *loop)
+static void
+gt_trampoline_release(GtLoop *loop, gt_trampoline *trampoline)
 {
-	return loop->vmi;
+	trampoline->state = (gt_syscall_state) { 0 };
+	loop->free_trampolines[loop->free_trampoline_count++] = trampoline - loop->trampolines;
 }
 
-/**
- * gt_guest_get_register:
- * @state: a pointer to a #GtGuestState.
- * @name: name of register to get.
- *
- * Returns the value of the named register from the guest state.
+/*
+ * Claim a free trampoline for the system call made by thread_id. If none is
+ * free, first reclaim those abandoned by calls which will never return.
+ * Returns NULL if every trampoline remains in use.
  */
-gt_reg_t
-gt_guest_get_register(GtGuestState *state, gt_reg_name_t name)
+static gt_trampoline *
+gt_trampoline_claim(GtLoop *loop, addr_t thread_id)
 {
-	gt_reg_t reg = 0;
+	gt_trampoline *trampoline = NULL;
 
-	switch (name) {
-	case RAX:
+	if (0 == loop->free_trampoline_count) {
+		for (guint i = 0; i < loop->trampoline_count; i++) {
+			if (!gt_trampoline_is_live(loop, &loop->trampolines[i])) {
+				gt_trampoline_release(loop, &loop->trampolines[i]);
+			}
+		}
+	}
+
+	if (0 == loop->free_trampoline_count) {
+		goto done;
+	}
+
+	trampoline = &loop->trampolines[loop->free_trampolines[--loop->free_trampoline_count]];
+	trampoline->state.thread_id = thread_id;
+
+done:
+	return trampoline;
+}
+
+/* A return pointer on a kernel stack, for gt_restore_return_addrs(). */
+typedef struct gt_stack_slot {
+	addr_t va;
+	addr_t trampoline; /* Restore only if the slot still holds this; or 0. */
+} gt_stack_slot;
+
+static gint
+gt_stack_slot_compare(gconstpointer a, gconstpointer b)
+{
+	const gt_stack_slot *x = a, *y = b;
+
+	return x->va < y->va ? -1 : x->va > y->va;
+}
+
+/*
+ * Restore the return pointer of each in-flight system call, so the kernel
+ * continues to run after guestrace detaches; then forget the calls and free
+ * their trampolines. Otherwise, guestrace's stack manipulation might remain
+ * in place, since guestrace might no longer exist at the time of a
+ * system-call return.
+ *
+ * libvmi cannot batch writes, so this call instead visits the slots in
+ * address order and translates each stack page once, rather than walking
+ * the guest's page tables for every slot. Calls holding a private
+ * trampoline which never return, such as exit, leave nothing to restore.
+ */
+static void
+gt_restore_return_addrs(GtLoop *loop)
+{
+	GArray *slots = g_array_new(FALSE, FALSE, sizeof (gt_stack_slot));
+	addr_t page = 0, page_pa = 0;
+	guint failures = 0;
+
+	if (NULL != loop->syscall_states) {
+		addr_t size = 1ull << loop->syscall_states_bits;
+
+		for (addr_t i = 0; i < size; i++) {
+			if (0 != loop->syscall_states[i].thread_id) {
+				gt_stack_slot slot = { loop->syscall_states[i].thread_id, 0 };
+				g_array_append_val(slots, slot);
+			}
+		}
+
+		memset(loop->syscall_states, 0, size * sizeof *loop->syscall_states);
+		loop->syscall_states_count = 0;
+	}
+
+	for (guint i = 0; i < loop->trampoline_count; i++) {
+		gt_trampoline *trampoline = &loop->trampolines[i];
+
+		if (0 == trampoline->state.thread_id) {
+			continue;
+		}
+
+		gt_stack_slot slot = { trampoline->state.thread_id, trampoline->va };
+		g_array_append_val(slots, slot);
+
+		gt_trampoline_release(loop, trampoline);
+	}
+
+	g_array_sort(slots, gt_stack_slot_compare);
+
+	for (guint i = 0; i < slots->len; i++) {
+		gt_stack_slot *slot = &g_array_index(slots, gt_stack_slot, i);
+		addr_t return_addr = 0;
+
+		if (0 == page_pa || page != slot->va >> GT_PAGE_OFFSET_BITS) {
+			page    = slot->va >> GT_PAGE_OFFSET_BITS;
+			page_pa = vmi_translate_kv2p(loop->vmi, page << GT_PAGE_OFFSET_BITS);
+		}
+
+		if (0 == page_pa) {
+			failures++;
+			continue;
+		}
+
+		addr_t pa = page_pa + (slot->va & (GT_PAGE_SIZE - 1));
+
+		/* The kernel has reused the stack of a call which never returned. */
+		if (0 != slot->trampoline
+		 && (VMI_SUCCESS != vmi_read_64_pa(loop->vmi, pa, &return_addr)
+		  || return_addr != slot->trampoline)) {
+			continue;
+		}
+
+		if (VMI_SUCCESS != vmi_write_64_pa(loop->vmi, pa, &loop->return_addr)) {
+			failures++;
+		}
+	}
+
+	if (0 != failures) {
+		fprintf(stderr, "error restoring %u stacks; guest will likely fail\n", failures);
+	}
+
+	g_array_free(slots, TRUE);
+}
+
+/*
+ * Service a type-two breakpoint on behalf of the system call described by
+ * state, and direct the VCPU to the original return point.
+ */
+static void
+gt_service_sysret(GtLoop *loop,
+                  vmi_event_t *event,
+                  gt_syscall_state *state,
+                  addr_t thread_id,
+                  GtVcpuStats *stats,
+                  guint64 *since)
+{
+	if (state->syscall_paddr_record->flushes_process_caches) {
+		/* E.g., execve replaced the address space. */
+		gt_flush_process_caches(loop);
+	}
+
+	gt_pid_t pid = gt_dtb_to_pid(loop, event->x86_regs->cr3);
+	gt_stats_lap(stats, GT_PHASE_PID, since);
+
+	state->sysret_cb(&(GtGuestState) { loop, loop->vmi, event, .cb_id = state->syscall_paddr_record->id },
+	                 pid,
+	                 thread_id,
+	                 state->data);
+	gt_stats_lap(stats, GT_PHASE_CALLBACK, since);
+
+	stats->returns++;
+	state->syscall_paddr_record->returns++;
+
+	vmi_set_vcpureg(loop->vmi, loop->return_addr, RIP, event->vcpu_id);
+	gt_stats_lap(stats, GT_PHASE_RIP_SET, since);
+}
+
+/**
+ * gt_guest_free_syscall_state:
+ * @state: a pointer to a #GtGuestState.
+ * @thread_id: the thread ID associated with the syscall to free.
+ *
+ * Frees the object which the guestrace event loop would have allocated
+ * when processing the system call associated with @thread_id. This is useful
+ * for system calls that never return (unless there is an error) such as execve.
+ * The application must first free the object pointed to by the @data
+ * argument to the #GtSyscallFunc before calling this function. The
+ * application should not call this function if the guestrace event loop
+ * will call #GtSysretFunc.
+ */
+void
+gt_guest_free_syscall_state(GtGuestState *state, gt_tid_t thread_id)
+{
+	GtLoop *loop = state->loop;
+
+	if (NULL != loop->replay) {
+		gt_replay_free_syscall_state(loop, thread_id);
+		goto done;
+	}
+
+	for (guint i = 0; i < loop->trampoline_count; i++) {
+		if (thread_id == loop->trampolines[i].state.thread_id) {
+			gt_trampoline_release(loop, &loop->trampolines[i]);
+			goto done;
+		}
+	}
+
+	gt_syscall_state_remove(loop, thread_id);
+
+done:
+	return;
+}
+
+static void gt_sampling_arm(gt_paddr_record *record, gboolean arm);
+
+/*
+ * Return whether record's sampler passes this call by pid to the callbacks,
+ * counting the calls it skips. A sampler over its budget has the breakpoint
+ * disarmed until gt_sampling_tick() finds the budget replenished.
+ */
+static gboolean
+gt_sample(gt_paddr_record *record, gt_pid_t pid)
+{
+	gt_sample_verdict verdict = gt_sampler_admit(record->sampler, pid, gt_stats_now());
+
+	if (GT_SAMPLE_PASS == verdict) {
+		return TRUE;
+	}
+
+	record->skipped++;
+
+	if (GT_SAMPLE_DISARM == verdict) {
+		gt_sampling_arm(record, FALSE);
+	}
+
+	return FALSE;
+}
+
+/*
+ * Service a triggered breakpoint. Restore the original page table for one
+ * single-step iteration and invoke the system call or return callback.
+ *
+ * In the case of a system call, enable the syscall return breakpoint.
+ *
+ * In the case of a system return, disable the syscall return breakpoint until
+ * the next system call enables it.
+ */
+static event_response_t
+gt_breakpoint_cb(vmi_instance_t vmi, vmi_event_t *event) {
+	event_response_t response = VMI_EVENT_RESPONSE_NONE;
+
+	GtLoop *loop = event->data;
+
+	/* Updates from other threads must not overlap callbacks. */
+	g_rec_mutex_lock(&loop->lock);
+
+	GtVcpuStats *stats = gt_vcpu_stats(loop, event);
+	guint64 since = gt_stats_now();
+	event->interrupt_event.reinject = 0;
+
+	gt_trampoline *trampoline = gt_trampoline_from_va(loop, event->interrupt_event.gla);
+
+	if (NULL == trampoline && event->interrupt_event.gla != loop->trampoline_addr) {
+		/* Type-one breakpoint (system call). */
+		status_t status;
+		addr_t thread_id, return_loc;
+		gt_paddr_record *record;
+		gt_syscall_state *state;
+
+		/* Lookup record corresponding to breakpoint address. */
+		record = gt_paddr_record_from_va(loop,
+		                                 event->interrupt_event.gla);
+		if (NULL == record) {
+			/* Assume we didn't emplace interrupt. */
+			event->interrupt_event.reinject = 1;
+			stats->reinjected++;
+			/* TODO: Ensure this does the right thing: */
+			goto done;
+		}
+
+		gt_stats_lap(stats, GT_PHASE_LOOKUP, &since);
+
+		/* Set VCPUs SLAT to use original for one step. */
+		event->slat_id = 0;
+
+		/* Turn on single-step and switch slat_id after return. */
+		response = gt_step_begin(loop, event)
+		         | VMI_EVENT_RESPONSE_VMM_PAGETABLE_ID;
+
+		/*
+		 * Testing indicated flushing libvmi's PID cache was necessary
+		 * to get vaddr translations to consistently work in a
+		 * GtSyscallFunc. Stale entries only arise when processes come
+		 * and go, so guestrace flushes only then.
+		 */
+		if (record->flushes_process_caches) {
+			gt_flush_process_caches(loop);
+		}
+
+		if (!record->enabled || loop->detaching) {
+			/*
+			 * Left in place only to flush caches, see above, or
+			 * trapped just before gt_loop_drain() removed it.
+			 */
+			goto done;
+		}
+
+		gt_pid_t pid = gt_dtb_to_pid(loop, event->x86_regs->cr3);
+		gt_stats_lap(stats, GT_PHASE_PID, &since);
+
+		/* Filters run before the return hijack, so no sysret trap. */
+		GtGuestState guest_state = { loop, vmi, event, .cb_id = record->id };
+		if (!gt_filter_match(loop->filter, &guest_state, pid)
+		 || !gt_filter_match(record->filter, &guest_state, pid)) {
+			goto done;
+		}
+
+		if (NULL != record->sampler && !gt_sample(record, pid)) {
+			goto done;
+		}
+
+		if (NULL == record->sysret_cb) {
+			/* Call-only mode; leave the return address alone. */
+			record->syscall_cb(&guest_state,
+			                   pid,
+			                   event->x86_regs->rsp,
+			                   record->data);
+			gt_stats_lap(stats, GT_PHASE_CALLBACK, &since);
+			stats->calls++;
+			record->calls++;
+			goto done;
+		}
+
+		thread_id = return_loc = event->x86_regs->rsp;
+
+		/* Time this read as part of the stack write below. */
+		guint64 read_time = gt_stats_now();
+		addr_t return_addr = 0;
+		status = vmi_read_64_va(vmi, return_loc, 0, &return_addr);
+		if (VMI_SUCCESS != status || return_addr != loop->return_addr) {
+			/* Return pointer not as expected. */
+			goto done;
+		}
+		read_time = gt_stats_now() - read_time;
+
+		/* Invoke system-call callback in record. */
+		void *data = record->syscall_cb(&guest_state,
+		                                pid,
+		                                thread_id,
+		                                record->data);
+		since += read_time;
+		gt_stats_lap(stats, GT_PHASE_CALLBACK, &since);
+		since -= read_time;
+
+		/* Record system-call state, preferably with its own trampoline. */
+		addr_t return_to = loop->trampoline_addr;
+		trampoline = gt_trampoline_claim(loop, thread_id);
+		if (NULL != trampoline) {
+			state     = &trampoline->state;
+			return_to = trampoline->va;
+		} else {
+			state = gt_syscall_state_insert(loop, thread_id);
+		}
+
+		state->syscall_paddr_record = record;
+		state->sysret_cb            = record->sysret_cb;
+		state->data                 = data;
+
+		/* Overwrite stack to return to trampoline. */
+		vmi_write_64_va(vmi, return_loc, 0, &return_to);
+		gt_stats_lap(stats, GT_PHASE_STACK_WRITE, &since);
+
+		stats->calls++;
+		record->calls++;
+	} else if (NULL != trampoline) {
+		/* Type-two breakpoint (system return) via private trampoline. */
+		addr_t thread_id = event->x86_regs->rsp - loop->return_addr_width;
+
+		if (thread_id != trampoline->state.thread_id) {
+			/* Not a return we hijacked; e.g., an int 3 used by kernel. */
+			event->interrupt_event.reinject = 1;
+			stats->reinjected++;
+			goto done;
+		}
+
+		gt_stats_lap(stats, GT_PHASE_LOOKUP, &since);
+
+		gt_service_sysret(loop, event, &trampoline->state, thread_id, stats, &since);
+
+		/* Sysret_cb must have freed state->data. */
+		gt_trampoline_release(loop, trampoline);
+	} else {
+		/* Type-two breakpoint (system return) via shared trampoline. */
+		gt_syscall_state *state;
+		addr_t thread_id = event->x86_regs->rsp - loop->return_addr_width;
+
+		state = gt_syscall_state_lookup(loop, thread_id);
+
+		if (NULL == state) {
+			stats->orphaned_returns++;
+		} else {
+			gt_stats_lap(stats, GT_PHASE_LOOKUP, &since);
+
+			gt_service_sysret(loop, event, state, thread_id, stats, &since);
+
+			/*
+			 * This will free our gt_syscall_state object, but
+			 * sysret_cb must have freed state->data.
+			 */
+			gt_syscall_state_remove(loop, thread_id);
+		}
+	}
+
+done:
+	g_rec_mutex_unlock(&loop->lock);
+
+	return response;
+}
+
+/* Return the record of the shadowed frame, or NULL if frame has no shadow. */
+static gt_page_record *
+gt_page_record_from_frame(GtLoop *loop, addr_t frame)
+{
+	addr_t shadow = (addr_t) g_hash_table_lookup(loop->gt_page_translation,
+	                                             GSIZE_TO_POINTER(frame));
+
+	if (0 == shadow) {
+		return NULL;
+	}
+
+	return g_hash_table_lookup(loop->gt_page_record_collection,
+	                           GSIZE_TO_POINTER(shadow));
+}
+
+/*
+ * Callback invoked on a R/W of a monitored page (likely Windows kernel patch
+ * protection). Switch the VCPU's SLAT to its original, step once, switch SLAT
+ * back. In execute-only mode, move the VCPU to the read view instead; it
+ * stays there, reading and writing the original frames without exits, until
+ * it executes a shadowed page.
+ */
+static event_response_t
+gt_mem_rw_cb (vmi_instance_t vmi, vmi_event_t *event) {
+	GtLoop *loop = event->data;
+	gt_page_record *page_record;
+	event_response_t response;
+
+	g_rec_mutex_lock(&loop->lock);
+
+	gt_vcpu_stats(loop, event)->mem_rw++;
+
+	page_record = gt_page_record_from_frame(loop, event->mem_event.gfn);
+	if (NULL != page_record) {
+		page_record->mem_rw++;
+
+		if (page_record->exec_trapped) {
+			page_record->view_switches++;
+			event->slat_id = loop->read_view;
+			response = VMI_EVENT_RESPONSE_VMM_PAGETABLE_ID;
+			goto done;
+		}
+
+		page_record->single_steps++;
+	}
+
+	/* Switch back to original SLAT for one step. */
+	event->slat_id = 0;
+
+	response = gt_step_begin(loop, event)
+	         | VMI_EVENT_RESPONSE_VMM_PAGETABLE_ID;
+
+done:
+	g_rec_mutex_unlock(&loop->lock);
+
+	return response;
+}
+
+/*
+ * Callback invoked when a VCPU in the read view executes a shadowed page.
+ * Return the VCPU to the shadow view, where the page holds its breakpoints.
+ */
+static event_response_t
+gt_mem_exec_cb (vmi_instance_t vmi, vmi_event_t *event) {
+	GtLoop *loop = event->data;
+	gt_page_record *page_record;
+
+	g_rec_mutex_lock(&loop->lock);
+
+	page_record = gt_page_record_from_frame(loop, event->mem_event.gfn);
+	if (NULL != page_record) {
+		page_record->exec_returns++;
+	}
+
+	event->slat_id = loop->shadow_view;
+
+	g_rec_mutex_unlock(&loop->lock);
+
+	return VMI_EVENT_RESPONSE_VMM_PAGETABLE_ID;
+}
+
+/* Have read_view trap execution of page_record's frame. */
+static gboolean
+gt_trap_execution(gt_page_record *page_record)
+{
+	GtLoop *loop = page_record->loop;
+	status_t status;
+
+	status = vmi_set_mem_event(loop->vmi,
+	                           page_record->frame,
+	                           VMI_MEMACCESS_X,
+	                           loop->read_view);
+
+	page_record->exec_trapped = VMI_SUCCESS == status;
+
+	return page_record->exec_trapped;
+}
+
+static void
+gt_tear_down_read_view(GtLoop *loop);
+
+/*
+ * Create the read view of execute-only mode, in which every frame maps to its
+ * original page, and which traps execution of each shadowed frame. If the
+ * hardware cannot trap execution alone, leave read_view zero, so that
+ * gt_mem_rw_cb() single-steps instead.
+ */
+static void
+gt_set_up_read_view(GtLoop *loop)
+{
+	GHashTableIter iter;
+	gpointer page_record;
+	status_t status;
+
+	if (!loop->execute_only) {
+		goto done;
+	}
+
+	status = vmi_slat_create(loop->vmi, &loop->read_view);
+	if (VMI_SUCCESS != status) {
+		loop->read_view = 0;
+		goto fail;
+	}
+
+	SETUP_MEM_EVENT(&loop->exec_event,
+	                ~0ULL,
+	                 VMI_MEMACCESS_X,
+	                 gt_mem_exec_cb,
+	                 1);
+
+	loop->exec_event.data = loop;
+
+	status = vmi_register_event(loop->vmi, &loop->exec_event);
+	if (VMI_SUCCESS != status) {
+		vmi_slat_destroy(loop->vmi, loop->read_view);
+		loop->read_view = 0;
+		goto fail;
+	}
+
+	/*
+	 * A VCPU in the read view would miss the breakpoints on any page which
+	 * it could execute there without a trap, so use it for every page or
+	 * for none.
+	 */
+	g_hash_table_iter_init(&iter, loop->gt_page_record_collection);
+	while (g_hash_table_iter_next(&iter, NULL, &page_record)) {
+		if (!gt_trap_execution(page_record)) {
+			gt_tear_down_read_view(loop);
+			goto fail;
+		}
+	}
+
+	goto done;
+
+fail:
+	fprintf(stderr, "execute-only view unavailable; single-stepping instead\n");
+
+done:
+	return;
+}
+
+/*
+ * Undo gt_set_up_read_view(). Destroying the view drops its execute traps,
+ * so there is no need to clear them page by page.
+ */
+static void
+gt_tear_down_read_view(GtLoop *loop)
+{
+	GHashTableIter iter;
+	gpointer data;
+
+	if (0 == loop->read_view) {
+		goto done;
+	}
+
+	g_hash_table_iter_init(&iter, loop->gt_page_record_collection);
+	while (g_hash_table_iter_next(&iter, NULL, &data)) {
+		gt_page_record *page_record = data;
+
+		page_record->exec_trapped = FALSE;
+	}
+
+	vmi_clear_event(loop->vmi, &loop->exec_event, NULL);
+	vmi_slat_destroy(loop->vmi, loop->read_view);
+	loop->read_view = 0;
+
+done:
+	return;
+}
+
+/*
+ * Setup our global interrupt to catch any interrupts on any pages.
+ */
+static bool
+gt_set_up_generic_events (GtLoop *loop) {
+	bool ok = false;
+	status_t status;
+
+	SETUP_INTERRUPT_EVENT(&loop->breakpoint_event, 0, gt_breakpoint_cb);
+	loop->breakpoint_event.data = loop;
+
+	status = vmi_register_event(loop->vmi, &loop->breakpoint_event);
+	if (VMI_SUCCESS != status) {
+		fprintf(stderr, "Failed to setup interrupt event\n");
+		goto done;
+	}
+
+	SETUP_MEM_EVENT(&loop->memory_event,
+	                ~0ULL,
+	                 VMI_MEMACCESS_RW,
+	                 gt_mem_rw_cb,
+	                 1);
+
+	loop->memory_event.data = loop;
+
+	status = vmi_register_event(loop->vmi, &loop->memory_event);
+	if (VMI_SUCCESS != status) {
+		fprintf(stderr, "failed to setup memory event\n");
+		goto done;
+	}
+
+	ok = true;
+
+done:
+	return ok;
+}
+
+/* Search the kernel code address space for an existing int 3 instruction. */
+addr_t
+gt_find_trampoline_addr (GtLoop *loop)
+{
+	addr_t trampoline_addr = 0;
+	status_t status;
+	addr_t lstar = 0;
+	uint8_t code[GT_PAGE_SIZE] = { 0 }; /* Assume CALL is within first page. */
+	gint *offsets = NULL;
+	gsize offset_count = 0;
+
+	/* LSTAR should be constant across all VCPUs */
+	status = vmi_get_vcpureg(loop->vmi, &lstar, MSR_LSTAR, 0);
+	if (VMI_SUCCESS != status) {
+		fprintf(stderr, "failed to get MSR_LSTAR address\n");
+		goto done;
+	}
+
+	g_assert(loop->lstar_addr == lstar);
+
+	/*
+	 * The attach cache cannot vouch for this page, whose bytes hold
+	 * relocated addresses, so scan it on every attach; a wrong trampoline
+	 * would send system calls astray.
+	 */
+	addr_t lstar_p = vmi_translate_kv2p(loop->vmi, lstar);
+	if (0 == lstar_p) {
+		fprintf(stderr, "failed to translate virtual LSTAR to physical address");
+		goto done;
+	}
+
+	/* Read kernel instructions into code. */
+	status = vmi_read_pa(loop->vmi, lstar_p, code, sizeof(code));
+	if (status < GT_PAGE_SIZE) {
+		fprintf(stderr, "failed to read instructions from 0x%lx.\n",
+		                 lstar_p);
+		goto done;
+	}
+
+	offsets = g_new(gint, GT_PAGE_SIZE);
+	for (int curr_inst = 0; curr_inst < GT_PAGE_SIZE; curr_inst++) {
+		if (code[curr_inst] == GT_BREAKPOINT_INST) {
+			offsets[offset_count++] = curr_inst;
+		}
+	}
+
+	/*
+	 * Look for int 3. The first serves as the shared trampoline; later
+	 * ones serve as private trampolines.
+	 */
+	loop->trampolines         = g_new0(gt_trampoline, GT_MAX_TRAMPOLINES);
+	loop->free_trampolines    = g_new0(guint, GT_MAX_TRAMPOLINES);
+	loop->trampoline_offsets  = g_new0(uint8_t, GT_PAGE_SIZE);
+	loop->trampoline_count    = 0;
+
+	for (gsize j = 0; j < offset_count; j++) {
+		int curr_inst = offsets[j];
+
+		if (curr_inst < 0 || curr_inst >= GT_PAGE_SIZE) {
+			continue;
+		}
+
+		if (0 == trampoline_addr) {
+			trampoline_addr = lstar + curr_inst;
+		} else if (loop->trampoline_count < GT_MAX_TRAMPOLINES) {
+			guint i = loop->trampoline_count++;
+			loop->trampolines[i].va  = lstar + curr_inst;
+			loop->trampoline_offsets[curr_inst] = i + 1;
+		}
+	}
+
+	/* Hand out trampolines in address order. */
+	loop->free_trampoline_count = 0;
+	for (guint i = loop->trampoline_count; i > 0; i--) {
+		loop->free_trampolines[loop->free_trampoline_count++] = i - 1;
+	}
+
+done:
+	g_free(offsets);
+
+	return trampoline_addr;
+}
+
+static void
+gt_free_trampolines(GtLoop *loop)
+{
+	g_free(loop->trampolines);
+	g_free(loop->free_trampolines);
+	g_free(loop->trampoline_offsets);
+
+	loop->trampolines           = NULL;
+	loop->free_trampolines      = NULL;
+	loop->trampoline_offsets    = NULL;
+	loop->trampoline_count      = 0;
+	loop->free_trampoline_count = 0;
+}
+
+/*
+ * Allocate the parts of a loop which do not depend on a guest, so that
+ * gt_loop_free() can free the loop however far its caller gets in setting
+ * it up. Leaves quit_pipe -1 if it cannot create the pipe.
+ */
+GtLoop *
+_gt_loop_alloc(const char *guest_name)
+{
+	int rc;
+	GtLoop *loop = g_new0(GtLoop, 1);
+
+	loop->g_main_loop = g_main_loop_new(NULL, true);
+	loop->running     = TRUE;
+	g_rec_mutex_init(&loop->lock);
+	loop->guest_name  = guest_name;
+	loop->event_fd    = -1;
+
+	loop->gt_page_translation = g_hash_table_new(NULL, NULL);
+	loop->gt_page_record_collection = g_hash_table_new_full(NULL,
+	                                                        NULL,
+	                                                        NULL,
+	                                                        gt_destroy_page_record);
+	loop->gt_process_names = g_hash_table_new_full(NULL,
+	                                               NULL,
+	                                               NULL,
+	                                               gt_destroy_process_name);
+	loop->gt_dtb_pids = g_hash_table_new(NULL, NULL);
+	loop->retired_records = g_ptr_array_new_with_free_func(gt_free_paddr_record);
+	loop->cb_names        = g_ptr_array_new_with_free_func(g_free);
+	loop->cb_ids          = g_hash_table_new(g_str_hash, g_str_equal);
+
+	rc = pipe(loop->quit_pipe);
+	if (-1 == rc) {
+		perror("failed to create quit pipe");
+		loop->quit_pipe[0] = loop->quit_pipe[1] = -1;
+		goto done;
+	}
+
+	/* gt_loop_quit() must never block, even in a signal handler. */
+	fcntl(loop->quit_pipe[1], F_SETFL, O_NONBLOCK);
+
+done:
+	return loop;
+}
+
+/**
+ * gt_loop_new:
+ * @guest_name: the name of a running guest virtual machine.
+ *
+ * Creates a new #GtLoop structure.
+ *
+ * Returns: a new #GtLoop.
+ **/
+GtLoop *gt_loop_new(const char *guest_name)
+{
+	int i;
+	GtLoop *loop;
+	int rc;
+	status_t status = VMI_FAILURE;
+
+	loop = _gt_loop_alloc(guest_name);
+	if (-1 == loop->quit_pipe[0]) {
+		goto done;
+	}
+
+	/* Initialize the libvmi library. */
+	for (i = 0; i < 300; i++) {
+		status = vmi_init(&loop->vmi,
+				   VMI_XEN | VMI_INIT_COMPLETE | VMI_INIT_EVENTS,
+				   guest_name);
+
+		if (VMI_SUCCESS == status) {
+			break;
+		}
+
+		usleep(100000);
+	}
+
+	/* Did vmi_init fail too many times above? */
+	if (VMI_SUCCESS != status) {
+		fprintf(stderr, "failed to init LibVMI library.\n");
+		goto done;
+	}
+
+	/* Only a libvmi patched to export its event channel provides this. */
+#ifdef HAVE_VMI_EVENT_GET_FD
+	loop->event_fd = vmi_event_get_fd(loop->vmi);
+#endif
+
+	vmi_pause_vm(loop->vmi);
+
+	loop->os = vmi_get_ostype(loop->vmi);
+	switch (loop->os) {
+	case VMI_OS_LINUX:
+		loop->os_functions = &os_functions_linux;
+		break;
+	case VMI_OS_WINDOWS:
+		loop->os_functions = &os_functions_windows;
+		break;
+	default:
+		fprintf(stderr, "unknown guest operating system\n");
+		status = VMI_FAILURE;
+		goto done;
+	}
+
+	loop->return_addr_width = vmi_get_address_width(loop->vmi);
+
+	loop->xch = xc_interface_open(0, 0, 0);
+	if (NULL == loop->xch) {
+		fprintf(stderr, "failed to create xc interface\n");
+                status = VMI_FAILURE;
+		goto done;
+	}
+
+	rc = libxl_ctx_alloc(&loop->ctx, LIBXL_VERSION, 0, NULL);
+	if (0 != rc) {
+		fprintf(stderr, "failed to create libxl context\n");
+                status = VMI_FAILURE;
+		goto done;
+	}
+
+	loop->domid = ~0u;
+	rc = libxl_name_to_domid(loop->ctx, guest_name, &loop->domid);
+	if (0 != rc || ~0u == loop->domid) {
+		fprintf(stderr, "failed to translate guest name to dom. ID\n");
+                status = VMI_FAILURE;
+		goto done;
+	}
+
+	loop->curr_mem_size = loop->init_mem_size = vmi_get_memsize(loop->vmi);
+	if (0 == loop->init_mem_size) {
+		fprintf(stderr, "failed to get guest memory size\n");
+                status = VMI_FAILURE;
+		goto done;
+	}
+
+	status = vmi_slat_set_domain_state(loop->vmi, TRUE);
+	if (VMI_SUCCESS != status) {
+		fprintf(stderr, "failed to enable slat/altp2m on guest\n");
+		goto done;
+	}
+
+	status = vmi_slat_create(loop->vmi, &loop->shadow_view);
+	if (VMI_SUCCESS != status) {
+		fprintf(stderr, "failed to enable shadow view\n");
+		goto done;
+	}
+
+	vmi_resume_vm(loop->vmi);
+
+done:
+	if (VMI_SUCCESS != status) {
+		gt_loop_free(loop);
+		loop = NULL;
+	}
+
+	return loop;
+}
+
+/**
+ * gt_loop_get_ostype:
+ * @loop: a #GtLoop.
+ *
+ * Returns: the OS type of #GtLoop.
+ **/
+GtOSType
+gt_loop_get_ostype(GtLoop *loop)
+{
+	switch (loop->os) {
+	case VMI_OS_LINUX:
+		return GT_OS_LINUX;
+	case VMI_OS_WINDOWS:
+		return GT_OS_WINDOWS;
+	default:
+		return GT_OS_UNKNOWN;
+	}
+}
+
+ /**
+ * gt_loop_get_guest_name:
+ * @loop: a #GtLoop.
+ *
+ * Returns: the name of the guest to which #GtLoop has attached. The #GtLoop
+ * maintains ownership of the string. Thus the returned string must not be
+ * freed by the caller.
+ **/
+const char *
+gt_loop_get_guest_name(GtLoop *loop)
+{
+	return loop->guest_name;
+}
+
+/**
+ * gt_loop_get_vmi_instance:
+ * @loop: a pointer to a #GtLoop.
+ *
+ * Returns the vmi_instance_t associated with @loop. Refer to the libvmi
+ * documentation for a description of vmi_instance_t.
+ */
+vmi_instance_t
+gt_loop_get_vmi_instance(GtLoop *loop)
+{
+	return loop->vmi;
+}
+
+/**
+ * gt_guest_get_register:
+ * @state: a pointer to a #GtGuestState.
+ * @name: name of register to get.
+ *
+ * Returns the value of the named register from the guest state.
+ */
+gt_reg_t
+gt_guest_get_register(GtGuestState *state, gt_reg_name_t name)
+{
+	gt_reg_t reg = 0;
+
+	switch (name) {
+	case RAX:
 		reg = state->event->x86_regs->rax;
 		goto done;
-	case RSP:
-		reg = state->event->x86_regs->rsp;
+	case RSP:
+		reg = state->event->x86_regs->rsp;
+		goto done;
+	case RDI:
+		reg = state->event->x86_regs->rdi;
+		goto done;
+	case RSI:
+		reg = state->event->x86_regs->rsi;
+		goto done;
+	case RCX:
+		reg = state->event->x86_regs->rcx;
+		goto done;
+	case RDX:
+		reg = state->event->x86_regs->rdx;
+		goto done;
+	case R8:
+		reg = state->event->x86_regs->r8;
+		goto done;
+	case R9:
+		reg = state->event->x86_regs->r9;
+		goto done;
+	case R10:
+		reg = state->event->x86_regs->r10;
+		goto done;
+	}
+
+	g_assert_not_reached();
+
+done:
+	return reg;
+}
+
+/**
+ * gt_guest_get_string:
+ * @state: a pointer to a #GtGuestState.
+ * @vaddr: a virtual address from the guest's address space.
+ * @pid: PID of the virtual address space (0 for kernel).
+ *
+ * Returns the NULL-terminated string which starts at @vaddr or NULL on error.
+ * The returned string must be freed by the caller.
+ */
+char *
+gt_guest_get_string(GtGuestState *state, gt_addr_t vaddr, gt_pid_t pid)
+{
+	GtStringView view;
+
+	if (!gt_guest_get_string_view(state, vaddr, pid, &view)) {
+		return NULL;
+	}
+
+	return g_strndup(view.data, view.length);
+}
+
+/**
+ * gt_guest_get_argv:
+ * @state: a pointer to a #GtGuestState.
+ * @vaddr: a virtual address from the guest's address space.
+ * @pid: PID of the virtual address space (0 for kernel).
+ *
+ * Returns the NULL-terminated argv-style array which starts at @vaddr
+ * or NULL on error. Each item in the array is a string.
+ * The array and each string in the array must be freed by the caller.
+ */
+char **
+gt_guest_get_argv(GtGuestState *state, gt_addr_t vaddr, gt_pid_t pid)
+{
+	guint count;
+	char **argv = NULL;
+	const GtStringView *views = gt_guest_get_argv_view(state, vaddr, pid, &count);
+
+	if (NULL == views) {
+		goto done;
+	}
+
+	argv = g_new(char *, count + 1);
+
+	for (guint i = 0; i < count; i++) {
+		argv[i] = g_strndup(views[i].data, views[i].length);
+	}
+
+	argv[count] = NULL;
+
+done:
+	return argv;
+}
+
+/**
+ * gt_guest_get_process_name:
+ * @state: a pointer to a #GtGuestState.
+ * @pid: PID of the process running when the event occurred.
+ *
+ * Returns the name of the process identified by @pid or NULL on error. The
+ * guestrace event loop caches names by PID and DTB, and it only walks the
+ * guest's process list after a process starts or exits. The #GtLoop
+ * maintains ownership of the string. Thus the returned string must not be
+ * freed by the caller, and it remains valid only until the callback returns.
+ */
+const char *
+gt_guest_get_process_name(GtGuestState *state, gt_pid_t pid)
+{
+	GtLoop *loop = state->loop;
+	addr_t dtb = state->event->x86_regs->cr3;
+	gt_process_name *process_name = NULL;
+	char *name;
+
+	if (NULL != loop->replay) {
+		/* A trace records no process names. */
+		goto done;
+	}
+
+	process_name = g_hash_table_lookup(loop->gt_process_names,
+	                                   GINT_TO_POINTER(pid));
+	if (NULL != process_name && dtb == process_name->dtb) {
+		goto done;
+	}
+
+	name = loop->os_functions->get_process_name(loop, pid);
+	if (NULL == name) {
+		process_name = NULL;
+		goto done;
+	}
+
+	process_name       = g_new0(gt_process_name, 1);
+	process_name->dtb  = dtb;
+	process_name->name = name;
+
+	g_hash_table_insert(loop->gt_process_names,
+	                    GINT_TO_POINTER(pid),
+	                    process_name);
+
+done:
+	return NULL == process_name ? NULL : process_name->name;
+}
+
+/**
+ * gt_guest_get_vmi_instance:
+ * @state: a pointer to a #GtGuestState.
+ *
+ * Returns the vmi_instance_t associated with @state. Refer to the libvmi
+ * documentation for a description of vmi_instance_t.
+ */
+vmi_instance_t
+gt_guest_get_vmi_instance(GtGuestState *state)
+{
+	return state->vmi;
+}
+
+/**
+ * gt_guest_get_vmi_event:
+ * @state: a pointer to a #GtGuestState.
+ *
+ * Returns the vmi_event_t associated with @state. Refer to the libvmi
+ * documentation for a description of vmi_event_t.
+ */
+vmi_event_t *
+gt_guest_get_vmi_event(GtGuestState *state)
+{
+	return state->event;
+}
+
+/**
+ * gt_guest_get_cb_id:
+ * @state: a pointer to a #GtGuestState.
+ *
+ * Returns the ID of the callback which the loop invoked with @state. The
+ * loop numbers the kernel functions which have callbacks from zero, in the
+ * order in which it instrumented them, so a program can index arrays by ID
+ * rather than hash names; gt_loop_get_cb_count() bounds the IDs. A
+ * function keeps its ID if its callbacks are removed and set again.
+ */
+guint
+gt_guest_get_cb_id(GtGuestState *state)
+{
+	return state->cb_id;
+}
+
+/*
+ * Return the ID of kernel_func, assigning the next one if kernel_func has
+ * none; see gt_guest_get_cb_id(). Callers must hold loop->lock.
+ */
+guint
+_gt_loop_cb_id(GtLoop *loop, const char *kernel_func)
+{
+	guint id = GPOINTER_TO_UINT(g_hash_table_lookup(loop->cb_ids, kernel_func));
+
+	if (0 == id) {
+		char *name = g_strdup(kernel_func);
+
+		g_ptr_array_add(loop->cb_names, name);
+		id = loop->cb_names->len;
+		g_hash_table_insert(loop->cb_ids, name, GUINT_TO_POINTER(id));
+	}
+
+	return id - 1;
+}
+
+/**
+ * gt_loop_get_cb_name:
+ * @loop: a #GtLoop.
+ * @id: a callback ID; see gt_guest_get_cb_id().
+ *
+ * Returns the name of the kernel function whose callbacks bear @id, or NULL
+ * if no callbacks bear @id. The name remains valid until @loop is freed.
+ */
+const char *
+gt_loop_get_cb_name(GtLoop *loop, guint id)
+{
+	const char *name = NULL;
+
+	g_rec_mutex_lock(&loop->lock);
+
+	if (id < loop->cb_names->len) {
+		name = g_ptr_array_index(loop->cb_names, id);
+	}
+
+	g_rec_mutex_unlock(&loop->lock);
+
+	return name;
+}
+
+/**
+ * gt_loop_get_cb_count:
+ * @loop: a #GtLoop.
+ *
+ * Returns the number of callback IDs which @loop has assigned; every ID is
+ * less than this. The count grows as callbacks are set on new functions.
+ */
+guint
+gt_loop_get_cb_count(GtLoop *loop)
+{
+	guint count;
+
+	g_rec_mutex_lock(&loop->lock);
+	count = loop->cb_names->len;
+	g_rec_mutex_unlock(&loop->lock);
+
+	return count;
+}
+
+/*
+ * Service the events libvmi has pending, waiting up to timeout milliseconds
+ * for one to arrive. Returns FALSE if the loop should stop.
+ */
+static gboolean
+gt_loop_service(GtLoop *loop, int timeout)
+{
+	/*
+	 * The event callbacks take loop->lock themselves, so that other
+	 * threads need not wait out the timeout to update the loop.
+	 */
+	status_t status = vmi_events_listen(loop->vmi, timeout);
+
+	if (status != VMI_SUCCESS) {
+		fprintf(stderr, "error waiting for events\n");
+		g_atomic_int_set(&loop->running, FALSE);
+	}
+
+	return g_atomic_int_get(&loop->running);
+}
+
+/*
+ * Sleep until gt_loop_quit() is called, timeout milliseconds pass (never, if
+ * timeout is negative), or, if events is TRUE, libvmi has events to service;
+ * then service those events. Returns FALSE if the loop should stop.
+ */
+gboolean
+_gt_loop_wait(GtLoop *loop, int timeout, gboolean events)
+{
+	int rc;
+	struct pollfd fds[] = {
+		{ .fd = loop->quit_pipe[0], .events = POLLIN },
+		{ .fd = loop->event_fd,     .events = POLLIN },
+	};
+
+	if (events && -1 == loop->event_fd) {
+		/* Without its file descriptor, libvmi must wait for us. */
+		return gt_loop_service(loop, timeout < 0 ? 500 : timeout);
+	}
+
+	rc = poll(fds, events ? 2 : 1, timeout);
+	if (-1 == rc && EINTR != errno) {
+		perror("error waiting for events");
+		g_atomic_int_set(&loop->running, FALSE);
+	}
+
+	if (events && rc > 0 && (fds[1].revents & POLLIN)) {
+		return gt_loop_service(loop, 0);
+	}
+
+	return g_atomic_int_get(&loop->running);
+}
+
+/* Service the events which libvmi's event channel signals. */
+static gboolean
+gt_loop_event_cb(GIOChannel *channel, GIOCondition condition, gpointer data)
+{
+	GtLoop *loop = data;
+	gboolean running = gt_loop_service(loop, 0);
+
+	if (!running) {
+		g_main_loop_quit(loop->g_main_loop);
+	}
+
+	return running;
+}
+
+/* Stop the main loop once gt_loop_quit() writes to the quit pipe. */
+static gboolean
+gt_loop_quit_cb(GIOChannel *channel, GIOCondition condition, gpointer data)
+{
+	GtLoop *loop = data;
+
+	g_main_loop_quit(loop->g_main_loop);
+
+	return FALSE;
+}
+
+/*
+ * Poll libvmi when it cannot provide a file descriptor; gt_loop_quit() then
+ * takes up to half a second to take effect.
+ */
+static gboolean
+gt_loop_listen(gpointer user_data)
+{
+	GtLoop *loop = user_data;
+	gboolean running = gt_loop_service(loop, 500);
+
+	if (!running) {
+		g_main_loop_quit(loop->g_main_loop);
+	}
+
+	return running;
+}
+
+static GSource *gt_add_watch(GMainContext *context,
+                             int fd,
+                             GIOCondition condition,
+                             GIOFunc func,
+                             gpointer user_data);
+
+static void gt_set_up_process_lifecycle_hooks(GtLoop *loop);
+static void gt_sampling_start(GtLoop *loop);
+static void gt_sampling_stop(GtLoop *loop);
+static status_t gt_remove_breakpoint(gt_paddr_record *paddr_record);
+
+/* Count the system calls whose returns guestrace still intercepts. */
+static guint
+gt_loop_calls_in_flight(GtLoop *loop)
+{
+	return loop->syscall_states_count
+	     + loop->trampoline_count - loop->free_trampoline_count;
+}
+
+/*
+ * Detach lazily; see gt_loop_set_lazy_detach(). Remove the breakpoints on
+ * calls, then go on servicing the returns of the calls in flight, until none
+ * remains or the timeout passes. Calls which never return, such as exit,
+ * hold the drain until the timeout.
+ */
+static void
+gt_loop_drain(GtLoop *loop)
+{
+	GHashTableIter iter, paddr_iter;
+	gpointer data;
+	gint64 deadline = g_get_monotonic_time()
+	                + loop->lazy_detach_ms * G_TIME_SPAN_MILLISECOND;
+
+	gt_loop_begin_update(loop);
+
+	loop->detaching = TRUE;
+
+	g_hash_table_iter_init(&iter, loop->gt_page_record_collection);
+	while (g_hash_table_iter_next(&iter, NULL, &data)) {
+		gt_page_record *page_record = data;
+
+		g_hash_table_iter_init(&paddr_iter, page_record->children);
+		while (g_hash_table_iter_next(&paddr_iter, NULL, &data)) {
+			gt_remove_breakpoint(data);
+		}
+	}
+
+	gt_loop_commit_update(loop);
+
+	while (0 != gt_loop_calls_in_flight(loop)) {
+		gint64 remaining = deadline - g_get_monotonic_time();
+		int timeout = (remaining + G_TIME_SPAN_MILLISECOND - 1) / G_TIME_SPAN_MILLISECOND;
+		status_t status = VMI_SUCCESS;
+
+		if (remaining <= 0) {
+			break;
+		}
+
+		if (-1 != loop->event_fd) {
+			struct pollfd fd = { .fd = loop->event_fd, .events = POLLIN };
+
+			if (poll(&fd, 1, timeout) <= 0) {
+				continue;
+			}
+
+			timeout = 0;
+		}
+
+		status = vmi_events_listen(loop->vmi, MIN(timeout, 500));
+
+		if (VMI_SUCCESS != status) {
+			fprintf(stderr, "error waiting for events\n");
+			break;
+		}
+	}
+
+	if (0 != gt_loop_calls_in_flight(loop)) {
+		fprintf(stderr, "%u calls still in flight after lazy detach\n",
+		        gt_loop_calls_in_flight(loop));
+	}
+}
+
+/**
+ * gt_loop_run:
+ * @loop: a #GtLoop.
+ *
+ * Uses libvmi to complete the preparations necessary to trace a guest's system
+ * calls. Runs @loop until gt_loop_quit() is called on @loop.
+ */
+void gt_loop_run(GtLoop *loop)
+{
+	status_t status;
+
+	if (NULL != loop->replay) {
+		gt_replay_run(loop);
+		goto done;
+	}
+
+	status = early_boot_wait_for_os_load(loop);
+	if (VMI_SUCCESS != status) {
+                fprintf(stderr, "failed to wait on LSTAR.\n");
+                goto done;
+        }
+
+	status = early_boot_wait_for_first_process(loop);
+	if (VMI_SUCCESS != status) {
+                fprintf(stderr, "failed to wait for initialization\n");
+                goto done;
+        }
+
+	vmi_pause_vm(loop->vmi);
+
+	status = vmi_slat_switch(loop->vmi, loop->shadow_view);
+	if (VMI_SUCCESS != status) {
+		fprintf(stderr, "failed to enable shadow view\n");
+		goto done;
+	}
+
+	if (!gt_set_up_generic_events(loop)) {
 		goto done;
-	case RDI:
-		reg = state->event->x86_regs->rdi;
+	}
+
+	if (!gt_set_up_step_events(loop)) {
 		goto done;
-	case RSI:
-		reg = state->event->x86_regs->rsi;
+	}
+
+	gt_set_up_read_view(loop);
+
+	gt_syscall_states_resize(loop,
+	                         vmi_get_num_vcpus(loop->vmi) * GT_SYSCALL_STATES_PER_VCPU);
+
+	/* Disassembling the system-call handler is costly; see attach-cache.c. */
+	if (!gt_attach_cache_lookup(loop, "return_point", &loop->return_addr)) {
+		loop->return_addr = loop->os_functions->find_return_point_addr(loop);
+		if (0 != loop->return_addr) {
+			gt_attach_cache_insert(loop, "return_point", loop->return_addr);
+		}
+	}
+
+	if (0 == loop->return_addr) {
+		goto done;
+	}
+
+	loop->trampoline_addr = gt_find_trampoline_addr(loop);
+	if (0 == loop->trampoline_addr) {
+		fprintf(stderr, "could not find addr. of existing int 3 inst.\n");
+		goto done;
+	}
+
+	gt_set_up_process_lifecycle_hooks(loop);
+
+	gt_attach_cache_save(loop);
+
+	gt_deferred_start(loop);
+
+	vmi_resume_vm(loop->vmi);
+
+	GMainContext *context = g_main_loop_get_context(loop->g_main_loop);
+	GSource *quit_source, *event_source;
+
+	quit_source = gt_add_watch(context,
+	                           loop->quit_pipe[0],
+	                           G_IO_IN,
+	                           gt_loop_quit_cb,
+	                           loop);
+
+	if (-1 != loop->event_fd) {
+		event_source = gt_add_watch(context,
+		                            loop->event_fd,
+		                            G_IO_IN,
+		                            gt_loop_event_cb,
+		                            loop);
+	} else {
+		event_source = g_idle_source_new();
+		g_source_set_callback(event_source, gt_loop_listen, loop, NULL);
+		g_source_attach(event_source, context);
+	}
+
+	g_rec_mutex_lock(&loop->lock);
+	loop->sampling_context = context;
+	gt_sampling_start(loop);
+	g_rec_mutex_unlock(&loop->lock);
+
+	/* Service any events which arrived before the watch existed. */
+	if (gt_loop_service(loop, 0)) {
+		g_main_loop_run(loop->g_main_loop);
+	}
+
+	g_rec_mutex_lock(&loop->lock);
+	gt_sampling_stop(loop);
+	loop->sampling_context = NULL;
+	g_rec_mutex_unlock(&loop->lock);
+
+	g_source_destroy(event_source);
+	g_source_unref(event_source);
+	g_source_destroy(quit_source);
+	g_source_unref(quit_source);
+
+	if (0 != loop->lazy_detach_ms) {
+		gt_loop_drain(loop);
+	}
+
+	vmi_pause_vm(loop->vmi);
+
+	/*
+	 * Nothing may service events once the stacks are restored below, so
+	 * gt_loop_quit() must have taken effect.
+	 */
+	g_assert(!g_atomic_int_get(&loop->running));
+
+	gt_deferred_stop(loop);
+
+	/* Restore the stacks first, while the trampolines still exist. */
+	gt_restore_return_addrs(loop);
+	gt_free_trampolines(loop);
+
+	status = vmi_slat_switch(loop->vmi, 0);
+	if (VMI_SUCCESS != status) {
+		fprintf(stderr, "failed to reset EPT to point to default table\n");
+	}
+
+	gt_tear_down_read_view(loop);
+
+	if (VMI_SUCCESS == status) {
+		gt_release_shadow_frames(loop);
+	}
+
+	g_hash_table_remove_all(loop->gt_page_translation);
+	g_hash_table_remove_all(loop->gt_page_record_collection);
+	g_ptr_array_set_size(loop->retired_records, 0);
+
+	g_free(loop->bp_index);
+	loop->bp_index = NULL;
+
+	vmi_resume_vm(loop->vmi);
+
+done:
+	return;
+}
+
+/**
+ * gt_loop_quit:
+ * @loop: a #GtLoop.
+ *
+ * Stops @loop from running. Any calls to gt_loop_run() for the loop will return.
+ * This removes any modifications to the guest's memory and allows the guest
+ * to run without instrumentation. It is safe to call this function from any
+ * thread, and from a signal handler.
+ */
+void gt_loop_quit(GtLoop *loop)
+{
+	G_GNUC_UNUSED ssize_t count;
+
+	g_atomic_int_set(&loop->running, FALSE);
+
+	/* Wake the loop; if the pipe is full, the loop is already awake. */
+	count = write(loop->quit_pipe[1], "", 1);
+}
+
+static gpointer
+gt_loop_thread(gpointer data)
+{
+	gt_loop_run(data);
+
+	return NULL;
+}
+
+/**
+ * gt_loop_start:
+ * @loop: a #GtLoop.
+ *
+ * Like gt_loop_run(), but runs @loop on a new thread and returns
+ * immediately. The thread services @loop's events using its own
+ * #GMainContext, so several loops may run at once, each driving a different
+ * guest. Call gt_loop_quit() and then gt_loop_join() to stop the loop.
+ */
+void
+gt_loop_start(GtLoop *loop)
+{
+	g_assert(NULL == loop->thread);
+
+	/* The default context can belong to only one thread at a time. */
+	GMainContext *context = g_main_context_new();
+	g_main_loop_unref(loop->g_main_loop);
+	loop->g_main_loop = g_main_loop_new(context, true);
+	g_main_context_unref(context);
+
+	loop->thread = g_thread_new(loop->guest_name, gt_loop_thread, loop);
+}
+
+/**
+ * gt_loop_join:
+ * @loop: a #GtLoop.
+ *
+ * Waits for the thread which gt_loop_start() created for @loop to exit.
+ * Returns immediately if @loop has no such thread.
+ */
+void
+gt_loop_join(GtLoop *loop)
+{
+	if (NULL != loop->thread) {
+		g_thread_join(loop->thread);
+		loop->thread = NULL;
+	}
+}
+
+/**
+ * gt_loop_is_running:
+ * @loop: a #GtLoop.
+ *
+ * Returns: %FALSE once gt_loop_quit() has stopped @loop or an error has
+ * forced it to stop, otherwise %TRUE.
+ */
+gboolean
+gt_loop_is_running(GtLoop *loop)
+{
+	return g_atomic_int_get(&loop->running);
+}
+
+/**
+ * gt_loop_get_stats:
+ * @loop: a #GtLoop.
+ *
+ * Copies the counters and phase timings which @loop keeps for each VCPU and
+ * the counters of each registered callback. A program may call this from any
+ * thread; the copy waits for the loop's thread to finish servicing events, so
+ * it is consistent but briefly delays the guest.
+ *
+ * Returns: the snapshot, which the caller must free with gt_stats_free().
+ */
+GtStats *
+gt_loop_get_stats(GtLoop *loop)
+{
+	GtStats *stats = g_new0(GtStats, 1);
+
+	g_rec_mutex_lock(&loop->lock);
+
+	stats->vcpu_count = loop->vcpu_count;
+	stats->vcpus      = g_new(GtVcpuStats, loop->vcpu_count);
+
+	for (guint i = 0; i < loop->vcpu_count; i++) {
+		stats->vcpus[i] = loop->vcpus[i]->stats;
+	}
+
+	if (NULL != loop->bp_index) {
+		guint64 slots = 1ull << loop->bp_index_bits;
+		GArray *syscalls = g_array_new(FALSE, FALSE, sizeof(GtSyscallStats));
+
+		for (guint64 i = 0; i < slots; i++) {
+			gt_paddr_record *record = loop->bp_index[i].record;
+			GtSyscallStats syscall;
+
+			if (0 == loop->bp_index[i].va) {
+				continue;
+			}
+
+			syscall.id      = record->id;
+			syscall.name    = g_strdup(record->name);
+			syscall.calls   = record->calls;
+			syscall.returns = record->returns;
+			syscall.skipped = record->skipped;
+			syscall.disarms = record->disarms;
+
+			g_array_append_val(syscalls, syscall);
+		}
+
+		stats->syscall_count = syscalls->len;
+		stats->syscalls      = (GtSyscallStats *) g_array_free(syscalls, FALSE);
+	}
+
+	if (NULL == loop->replay) {
+		GArray *pages = g_array_new(FALSE, FALSE, sizeof(GtPageStats));
+		GHashTableIter iter;
+		gpointer data;
+
+		g_hash_table_iter_init(&iter, loop->gt_page_record_collection);
+		while (g_hash_table_iter_next(&iter, NULL, &data)) {
+			gt_page_record *page_record = data;
+			GtPageStats page;
+
+			page.frame         = page_record->frame;
+			page.mem_rw        = page_record->mem_rw;
+			page.single_steps  = page_record->single_steps;
+			page.view_switches = page_record->view_switches;
+			page.exec_returns  = page_record->exec_returns;
+			page.exits_avoided = page.view_switches > page.exec_returns
+			                   ? page.view_switches - page.exec_returns
+			                   : 0;
+
+			g_array_append_val(pages, page);
+		}
+
+		stats->page_count = pages->len;
+		stats->pages      = (GtPageStats *) g_array_free(pages, FALSE);
+	}
+
+	g_rec_mutex_unlock(&loop->lock);
+
+	return stats;
+}
+
+/**
+ * gt_loop_free:
+ * @loop: a #GtLoop.
+ *
+ * Free @loop and its associated memory. If the loop is currently running, then
+ * gt_loop_quit() must first terminate the loop and remove the guest
+ * instrumentation.
+ */
+void gt_loop_free(GtLoop *loop)
+{
+	if (NULL == loop) {
+		goto done;
+	}
+
+	if (NULL == loop->replay) {
+		vmi_pause_vm(loop->vmi);
+	}
+
+	g_hash_table_destroy(loop->gt_page_translation);
+	g_free(loop->syscall_states);
+	gt_free_trampolines(loop);
+	g_hash_table_destroy(loop->gt_page_record_collection);
+	g_hash_table_destroy(loop->gt_process_names);
+	g_hash_table_destroy(loop->gt_dtb_pids);
+	g_ptr_array_free(loop->retired_records, TRUE);
+	g_hash_table_destroy(loop->cb_ids);
+	g_ptr_array_free(loop->cb_names, TRUE);
+	gt_filter_unref(loop->filter);
+	g_free(loop->bp_index);
+	gt_deferred_free(loop);
+	gt_args_free_pages(loop);
+	gt_vcpus_free(loop);
+	gt_attach_cache_free(loop);
+	g_free(loop->attach_cache_dir);
+
+	if (NULL != loop->replay) {
+		gt_replay_free(loop);
+	} else {
+		if (0 != loop->shadow_view) {
+			vmi_slat_destroy(loop->vmi, loop->shadow_view);
+		}
+		vmi_slat_set_domain_state(loop->vmi, FALSE);
+		/* TODO: find out why this isn't decreasing main memory on next run of guestrace */
+		xc_domain_setmaxmem(loop->xch, loop->domid, loop->init_mem_size);
+
+		libxl_ctx_free(loop->ctx);
+		xc_interface_close(loop->xch);
+
+		vmi_resume_vm(loop->vmi);
+
+		vmi_destroy(loop->vmi);
+	}
+
+	g_main_loop_unref(loop->g_main_loop);
+	g_rec_mutex_clear(&loop->lock);
+
+	if (-1 != loop->quit_pipe[0]) {
+		close(loop->quit_pipe[0]);
+		close(loop->quit_pipe[1]);
+	}
+
+	g_free(loop);
+
+done:
+	return;
+}
+
+/*
+ * Allocate count new pages of memory in the guest's address space, and store
+ * their frame numbers in gfns. This costs the same three hypercalls
+ * regardless of count. On failure, return any pages already allocated and
+ * restore the guest's memory limit.
+ */
+static gboolean
+gt_allocate_shadow_frames (GtLoop *loop, unsigned long count, xen_pfn_t *gfns)
+{
+	int rc;
+	gboolean ok = FALSE;
+	uint64_t proposed_mem_size = loop->curr_mem_size + count * GT_PAGE_SIZE;
+
+	rc = xc_domain_setmaxmem(loop->xch, loop->domid, proposed_mem_size);
+	if (rc < 0) {
+		fprintf(stderr,
+		       "failed to increase memory size on guest to %lx\n",
+		        proposed_mem_size);
+		goto done;
+	}
+
+	loop->curr_mem_size = proposed_mem_size;
+
+	rc = xc_domain_increase_reservation_exact(loop->xch, loop->domid,
+	                                          count, 0, 0, gfns);
+	if (rc < 0) {
+		fprintf(stderr, "failed to increase reservation on guest");
+		goto fail_mem_size;
+	}
+
+	rc = xc_domain_populate_physmap_exact(loop->xch, loop->domid, count, 0,
+	                                      0, gfns);
+	if (rc < 0) {
+		fprintf(stderr, "failed to populate %lu GFNs at 0x%lx\n", count, gfns[0]);
+		goto fail_reservation;
+	}
+
+	ok = TRUE;
+	goto done;
+
+fail_reservation:
+	xc_domain_decrease_reservation_exact(loop->xch, loop->domid, count, 0, gfns);
+
+fail_mem_size:
+	gt_lower_mem_size(loop, count);
+
+done:
+	return ok;
+}
+
+/*
+ * Return a new page of memory in the guest's address space, preferably one
+ * set aside by gt_reserve_shadow_frames().
+ */
+static addr_t
+gt_allocate_shadow_frame (GtLoop *loop)
+{
+	xen_pfn_t gfn = 0;
+
+	if (0 != loop->spare_shadow_frame_count) {
+		gfn = loop->spare_shadow_frames[--loop->spare_shadow_frame_count];
+		goto done;
+	}
+
+	if (!gt_allocate_shadow_frames(loop, 1, &gfn)) {
+		gfn = 0;
+	}
+
+done:
+	return gfn;
+}
+
+/*
+ * Return to Xen any pages gt_reserve_shadow_frames() set aside but unused,
+ * and lower the guest's memory limit to match.
+ */
+static void
+gt_release_spare_shadow_frames (GtLoop *loop)
+{
+	if (0 != loop->spare_shadow_frame_count) {
+		xc_domain_decrease_reservation_exact(loop->xch,
+		                                     loop->domid,
+		                                     loop->spare_shadow_frame_count,
+		                                     0,
+		                                     loop->spare_shadow_frames);
+		gt_lower_mem_size(loop, loop->spare_shadow_frame_count);
+	}
+
+	g_free(loop->spare_shadow_frames);
+	loop->spare_shadow_frames      = NULL;
+	loop->spare_shadow_frame_count = 0;
+}
+
+/*
+ * Set aside one shadow page for each distinct frame among the count virtual
+ * addresses in vas which lacks one, so that gt_setup_mem_trap() need not
+ * allocate them one at a time.
+ */
+static void
+gt_reserve_shadow_frames (GtLoop *loop, const addr_t *vas, int count)
+{
+	GHashTable *frames = g_hash_table_new(NULL, NULL);
+	unsigned long needed;
+
+	for (int i = 0; i < count; i++) {
+		if (0 == vas[i]) {
+			continue;
+		}
+
+		addr_t pa = vmi_translate_kv2p(loop->vmi, vas[i]);
+		if (0 == pa) {
+			continue;
+		}
+
+		addr_t frame = pa >> GT_PAGE_OFFSET_BITS;
+		if (!g_hash_table_contains(loop->gt_page_translation,
+		                           GSIZE_TO_POINTER(frame))) {
+			g_hash_table_add(frames, GSIZE_TO_POINTER(frame));
+		}
+	}
+
+	needed = g_hash_table_size(frames);
+	g_hash_table_destroy(frames);
+
+	if (0 == needed) {
+		goto done;
+	}
+
+	gt_release_spare_shadow_frames(loop);
+
+	loop->spare_shadow_frames = g_new0(xen_pfn_t, needed);
+	if (gt_allocate_shadow_frames(loop, needed, loop->spare_shadow_frames)) {
+		loop->spare_shadow_frame_count = needed;
+	}
+
+done:
+	return;
+}
+
+/* Write the breakpoint associated with paddr_record to its shadow page. */
+static status_t
+gt_set_breakpoint(gt_paddr_record *paddr_record) {
+	addr_t shadow_frame = paddr_record->parent->shadow_frame;
+
+	return vmi_write_8_pa(paddr_record->parent->loop->vmi,
+	                     (shadow_frame << GT_PAGE_OFFSET_BITS) + paddr_record->offset,
+	                     &GT_BREAKPOINT_INST);
+}
+
+/* Remove the breakpoint associated with paddr_record.  */
+static status_t
+gt_remove_breakpoint(gt_paddr_record *paddr_record) {
+	uint8_t curr_inst;
+	status_t status     = VMI_FAILURE;
+	addr_t frame        = paddr_record->parent->frame;
+	addr_t shadow_frame = paddr_record->parent->shadow_frame;
+	addr_t offset       = paddr_record->offset;
+
+	status = vmi_read_8_pa(paddr_record->parent->loop->vmi,
+	                      (frame << GT_PAGE_OFFSET_BITS) + offset,
+	                      &curr_inst);
+	if (VMI_SUCCESS != status) {
 		goto done;
-	case RCX:
-		reg = state->event->x86_regs->rcx;
+	}
+
+	status = vmi_write_8_pa(paddr_record->parent->loop->vmi,
+	                       (shadow_frame << GT_PAGE_OFFSET_BITS) + offset,
+	                       &curr_inst);
+
+done:
+	return status;
+}
+
+static void
+gt_destroy_paddr_record (gpointer data) {
+	gt_paddr_record *paddr_record = data;
+
+	gt_remove_breakpoint(paddr_record);
+
+	gt_free_paddr_record(paddr_record);
+}
+
+/*
+ * Ensure there exists a memory trap on the shadow page containing virtual
+ * address va, and create a page record if it does not yet exist. Add a
+ * physical-address record corresponding to va to the page record's collection
+ * of children.
+ */
+static gt_paddr_record *
+gt_setup_mem_trap (GtLoop *loop,
+                   addr_t va,
+                   GtSyscallFunc syscall_cb,
+                   GtSysretFunc sysret_cb,
+                   void *user_data)
+{
+	size_t ret;
+	status_t status;
+	gboolean new_shadow = FALSE;
+	addr_t frame = 0, shadow = 0, shadow_offset;
+	gt_page_record  *page_record  = NULL;
+	gt_paddr_record *paddr_record = NULL;
+
+	addr_t pa = vmi_translate_kv2p(loop->vmi, va);
+	if (0 == pa) {
+		fprintf(stderr, "virtual addr. translation failed: %lx\n", va);
 		goto done;
-	case RDX:
-		reg = state->event->x86_regs->rdx;
+	}
+
+	frame = pa >> GT_PAGE_OFFSET_BITS;
+	shadow = (addr_t) g_hash_table_lookup(loop->gt_page_translation,
+	                                      GSIZE_TO_POINTER(frame));
+	shadow_offset = pa % GT_PAGE_SIZE;
+
+	if (0 == shadow) {
+		/* Record does not exist; allocate new page and create record. */
+		shadow = gt_allocate_shadow_frame(loop);
+		if (0 == shadow) {
+			fprintf(stderr, "failed to allocate shadow page\n");
+			goto done;
+		}
+
+		new_shadow = TRUE;
+
+		g_hash_table_insert(loop->gt_page_translation,
+		                    GSIZE_TO_POINTER(frame),
+		                    GSIZE_TO_POINTER(shadow));
+
+		/* Activate in shadow view. */
+		status = vmi_slat_change_gfn(loop->vmi,
+		                             loop->shadow_view,
+		                             frame,
+		                             shadow);
+		if (VMI_SUCCESS != status) {
+			fprintf(stderr, "failed to update shadow view\n");
+			goto done;
+		}
+	}
+
+	page_record = g_hash_table_lookup(loop->gt_page_record_collection,
+	                                  GSIZE_TO_POINTER(shadow));
+	if (NULL == page_record) {
+		/* No record for this page yet; create one. */
+
+		/* Copy page to shadow. */
+		uint8_t buff[GT_PAGE_SIZE] = {0};
+		ret = vmi_read_pa(loop->vmi,
+		                  frame << GT_PAGE_OFFSET_BITS,
+		                  buff,
+		                  GT_PAGE_SIZE);
+		if (GT_PAGE_SIZE != ret) {
+			fprintf(stderr, "failed to read in syscall page\n");
+			goto done;
+		}
+
+		ret = vmi_write_pa(loop->vmi,
+		                   shadow << GT_PAGE_OFFSET_BITS,
+		                   buff,
+		                   GT_PAGE_SIZE);
+		if (GT_PAGE_SIZE != ret) {
+			fprintf(stderr, "failed to write to shadow page\n");
+			goto done;
+		}
+
+		/* Initialize record of this page. */
+		page_record              = g_new0(gt_page_record, 1);
+		page_record->shadow_frame = shadow;
+		page_record->frame       = frame;
+		page_record->loop        = loop;
+		page_record->children    = g_hash_table_new_full(NULL,
+		                                       NULL,
+		                                       NULL,
+		                                       gt_destroy_paddr_record);
+
+		g_hash_table_insert(loop->gt_page_record_collection,
+		                    GSIZE_TO_POINTER(shadow),
+		                    page_record);
+
+		/* Establish callback on a R/W of this page. */
+		vmi_set_mem_event(loop->vmi, frame, VMI_MEMACCESS_RW,
+		                  loop->shadow_view);
+
+		/* A VCPU in the read view must return to see the breakpoint. */
+		if (0 != loop->read_view && !gt_trap_execution(page_record)) {
+			fprintf(stderr, "failed to trap execution in read view\n");
+			goto done;
+		}
+	} else {
+		/* We already have a page record for this page in collection. */
+		paddr_record = g_hash_table_lookup(page_record->children,
+		                                GSIZE_TO_POINTER(shadow_offset));
+		if (NULL != paddr_record) {
+			/* We have a paddr record too; done (no error). */
+			goto done;
+		}
+	}
+
+	/* Create physical-address record and add to page record. */
+	paddr_record             = g_new0(gt_paddr_record, 1);
+	paddr_record->va         = va;
+	paddr_record->offset     = shadow_offset;
+	paddr_record->parent     = page_record;
+	paddr_record->syscall_cb = syscall_cb;
+	paddr_record->sysret_cb  = sysret_cb;
+	paddr_record->data       = user_data;
+	paddr_record->enabled    = TRUE;
+
+	/* Write interrupt to our shadow page at the correct location. */
+	status = gt_set_breakpoint(paddr_record);
+	if (VMI_SUCCESS != status) {
+		fprintf(stderr, "failed to write interrupt to shadow page\n");
+		g_free(paddr_record);
+		paddr_record = NULL;
 		goto done;
-	case R8:
-		reg = state->event->x86_regs->r8;
+	}
+
+	g_hash_table_insert(page_record->children,
+	                    GSIZE_TO_POINTER(shadow_offset),
+	                    paddr_record);
+
+	if (0 != loop->update_depth) {
+		/* Allow gt_loop_abort_update() to undo this. */
+		g_ptr_array_add(loop->update_records, paddr_record);
+	}
+
+done:
+	/* On error, undo whatever this call did to loop. */
+	if (NULL == paddr_record) {
+		if (NULL != page_record) {
+			if (0 == g_hash_table_size(page_record->children)) {
+				g_hash_table_remove(loop->gt_page_record_collection,
+				                    GSIZE_TO_POINTER(shadow));
+			}
+		} else if (new_shadow && 0 != shadow) {
+			gt_release_shadow_frame(loop, frame, shadow);
+		}
+	}
+
+	return paddr_record;
+}
+
+/*
+ * Remove the breakpoint described by paddr_record, along with its shadow page
+ * if no other breakpoint remains there. A system call in flight might still
+ * refer to paddr_record, so paddr_record lives on in retired_records until
+ * the loop stops.
+ */
+static void
+gt_unset_mem_trap (GtLoop *loop, gt_paddr_record *paddr_record)
+{
+	gt_page_record *page_record = paddr_record->parent;
+
+	if (NULL == page_record) {
+		/* Already retired. */
 		goto done;
-	case R9:
-		reg = state->event->x86_regs->r9;
+	}
+
+	g_hash_table_steal(page_record->children,
+	                   GSIZE_TO_POINTER(paddr_record->offset));
+
+	gt_remove_breakpoint(paddr_record);
+
+	paddr_record->parent = NULL;
+	g_ptr_array_add(loop->retired_records, paddr_record);
+
+	if (0 == g_hash_table_size(page_record->children)) {
+		g_hash_table_remove(loop->gt_page_record_collection,
+		                    GSIZE_TO_POINTER(page_record->shadow_frame));
+	}
+
+done:
+	return;
+}
+
+static void *
+gt_lifecycle_syscall_cb(GtGuestState *state, gt_pid_t pid, gt_tid_t tid, void *user_data)
+{
+	return NULL;
+}
+
+static void
+gt_lifecycle_sysret_cb(GtGuestState *state, gt_pid_t pid, gt_tid_t tid, void *user_data)
+{
+}
+
+static gboolean
+gt_is_in_list(const char * const *funcs, const char *kernel_func)
+{
+	for (int i = 0; NULL != funcs[i]; i++) {
+		if (0 == strcmp(funcs[i], kernel_func)) {
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+/*
+ * Return TRUE if gt_set_up_process_lifecycle_hooks() traps the returns of
+ * kernel_func; the other lifecycle functions never return to user space
+ * through the system-call handler, or are not system calls.
+ */
+static gboolean
+gt_is_process_create_func(GtLoop *loop, const char *kernel_func)
+{
+	return gt_is_in_list(loop->os_functions->process_create_funcs, kernel_func);
+}
+
+/* Return TRUE if kernel_func creates or destroys guest processes. */
+static gboolean
+gt_is_process_lifecycle_func(GtLoop *loop, const char *kernel_func)
+{
+	return gt_is_in_list(loop->os_functions->process_create_funcs, kernel_func)
+	    || gt_is_in_list(loop->os_functions->process_start_funcs, kernel_func)
+	    || gt_is_in_list(loop->os_functions->process_exit_funcs, kernel_func);
+}
+
+/*
+ * Instrument kernel_func, or sysaddr if it is not zero. Callers must do so
+ * between gt_loop_begin_update() and gt_loop_commit_update(), which pause the
+ * guest and rebuild bp_index.
+ */
+static gt_paddr_record *
+gt_register_cb(GtLoop *loop,
+               const char *kernel_func,
+               addr_t sysaddr,
+               GtSyscallFunc syscall_cb,
+               GtSysretFunc sysret_cb,
+               void *user_data)
+{
+	gt_paddr_record *syscall_trap = NULL;
+
+	if (0 == sysaddr) {
+		sysaddr = gt_attach_cache_ksym2v(loop, kernel_func);
+	}
+
+	if (0 == sysaddr) {
 		goto done;
-	case R10:
-		reg = state->event->x86_regs->r10;
+	}
+
+	syscall_trap = gt_setup_mem_trap(loop, sysaddr, syscall_cb, sysret_cb, user_data);
+	if (NULL == syscall_trap) {
 		goto done;
 	}
 
-	g_assert_not_reached();
+	if (gt_is_process_lifecycle_func(loop, kernel_func)) {
+		syscall_trap->flushes_process_caches = TRUE;
+	}
+
+	/*
+	 * gt_set_up_process_lifecycle_hooks() got here first; take over its
+	 * breakpoint, as gt_loop_remove_cb() hands it back. The flag above
+	 * keeps the caches flushing.
+	 */
+	if (gt_lifecycle_syscall_cb == syscall_trap->syscall_cb
+	 && gt_lifecycle_syscall_cb != syscall_cb) {
+		syscall_trap->syscall_cb = syscall_cb;
+		syscall_trap->sysret_cb  = sysret_cb;
+		syscall_trap->data       = user_data;
+		syscall_trap->enabled    = TRUE;
+	}
+
+	g_free(syscall_trap->name);
+	syscall_trap->name = g_strdup(kernel_func);
+	syscall_trap->id   = _gt_loop_cb_id(loop, kernel_func);
 
 done:
-	return reg;
+	return syscall_trap;
 }
 
 /**
- * gt_guest_get_string:
- * @state: a pointer to a #GtGuestState.
- * @vaddr: a virtual address from the guest's address space.
- * @pid: PID of the virtual address space (0 for kernel).
+ * gt_loop_begin_update:
+ * @loop: a #GtLoop.
  *
- * Returns the NULL-terminated string which starts at @vaddr or NULL on error.
- * The returned string must be freed by the caller.
+ * Begins a batch of callback registrations. The guest remains paused from
+ * this call until the matching gt_loop_commit_update() or
+ * gt_loop_abort_update(), so that gt_loop_set_cb() and gt_loop_set_cbs()
+ * need not pause and resume the guest for each callback. Batches may nest;
+ * only the outermost batch pauses and resumes the guest.
+ *
+ * While a batch is open, the thread running @loop blocks before servicing
+ * further events, so a program may update a loop from any thread; a batch
+ * waits only for the event being serviced, if any, not for the loop's
+ * thread to finish waiting for events.
  */
-char *
-gt_guest_get_string(GtGuestState *state, gt_addr_t vaddr, gt_pid_t pid)
+void
+gt_loop_begin_update(GtLoop *loop)
 {
-	return vmi_read_str_va(gt_guest_get_vmi_instance(state), vaddr, pid);
+	/* Wait for the loop's thread to finish servicing events. */
+	g_rec_mutex_lock(&loop->lock);
+
+	if (0 == loop->update_depth++) {
+		if (NULL == loop->replay) {
+			vmi_pause_vm(loop->vmi);
+		}
+		loop->update_records = g_ptr_array_new();
+		loop->update_aborted = FALSE;
+	}
 }
 
-/**
- * gt_guest_get_argv:
- * @state: a pointer to a #GtGuestState.
- * @vaddr: a virtual address from the guest's address space.
- * @pid: PID of the virtual address space (0 for kernel).
- *
- * Returns the NULL-terminated argv-style array which starts at @vaddr
- * or NULL on error. Each item in the array is a string.
- * The array and each string in the array must be freed by the caller.
+/*
+ * End one level of a batch. The outermost level undoes the batch if anything
+ * aborted it, brings the breakpoint index up to date, and resumes the guest.
  */
-char **
-gt_guest_get_argv(GtGuestState *state, gt_addr_t vaddr, gt_pid_t pid)
+static void
+gt_loop_end_update(GtLoop *loop)
 {
-	status_t status = VMI_SUCCESS;
-	int length = 16, i = 0;
-	char **argv = NULL;
-	vmi_instance_t vmi = gt_guest_get_vmi_instance(state);
+	g_assert(0 != loop->update_depth);
 
-	if (0 == vaddr) {
+	if (0 != --loop->update_depth) {
 		goto done;
 	}
 
-	argv = g_new0(char *, length);
-
-	do {
-		uint64_t vaddr2;
-		status = vmi_read_64_va(vmi, vaddr + (i * sizeof(char *)), pid, &vaddr2);
-		if (VMI_SUCCESS != status) {
-			goto done;
+	if (loop->update_aborted) {
+		/* Newest first, so each page outlives its later breakpoints. */
+		for (guint i = loop->update_records->len; i > 0; i--) {
+			gt_unset_mem_trap(loop, g_ptr_array_index(loop->update_records, i - 1));
 		}
-		if (vaddr2 != 0) {
-			if (i == length) {
-				length *= 2;
-				argv = g_renew(char *, argv, length);
-				memset(argv + i, 0x00, length - i);
-			}
-			argv[i] = vmi_read_str_va(vmi, vaddr2, pid);
-		} else {
-			argv[i] = NULL;
-		}
-	} while (argv[i++] != NULL);
+	}
 
-done:
-	if (VMI_SUCCESS != status) {
-		for (i = 0; argv[i]; i++) {
-			g_free(argv[i]);
-		}
-		g_free(argv);
-		argv = NULL;
+	g_ptr_array_free(loop->update_records, TRUE);
+	loop->update_records = NULL;
+
+	/* Index every breakpoint at once rather than once per callback. */
+	gt_bp_index_rebuild(loop);
+
+	if (NULL == loop->replay) {
+		vmi_resume_vm(loop->vmi);
 	}
 
-	return argv;
+done:
+	g_rec_mutex_unlock(&loop->lock);
 }
 
 /**
- * gt_guest_get_vmi_instance:
- * @state: a pointer to a #GtGuestState.
+ * gt_loop_commit_update:
+ * @loop: a #GtLoop.
  *
- * Returns the vmi_instance_t associated with @state. Refer to the libvmi
- * documentation for a description of vmi_instance_t.
+ * Ends a batch begun by gt_loop_begin_update(). Once the outermost batch
+ * ends, the callbacks it registered take effect and the guest resumes.
  */
-vmi_instance_t
-gt_guest_get_vmi_instance(GtGuestState *state)
+void
+gt_loop_commit_update(GtLoop *loop)
 {
-	return state->vmi;
+	gt_loop_end_update(loop);
 }
 
 /**
- * gt_guest_get_vmi_event:
- * @state: a pointer to a #GtGuestState.
+ * gt_loop_abort_update:
+ * @loop: a #GtLoop.
  *
- * Returns the vmi_event_t associated with @state. Refer to the libvmi
- * documentation for a description of vmi_event_t.
+ * Ends a batch begun by gt_loop_begin_update(), and arranges for the
+ * outermost batch to remove every callback registered since it began. This
+ * allows a program to treat a set of registrations as all or nothing, for
+ * example after gt_loop_set_cb() returns %FALSE partway through.
  */
-vmi_event_t *
-gt_guest_get_vmi_event(GtGuestState *state)
+void
+gt_loop_abort_update(GtLoop *loop)
 {
-	return state->event;
+	loop->update_aborted = TRUE;
+
+	gt_loop_end_update(loop);
 }
 
-static gboolean
-gt_loop_listen(gpointer user_data)
+/**
+ * gt_loop_set_cb:
+ * @loop: a #GtLoop.
+ * @kernel_func: the name of a function in the traced kernel which implements
+ * a system call.
+ * @syscall_cb: a #GtSyscallFunc which will handle the named system call.
+ * @sysret_cb: a #GtSysretFunc which will handle returns from the named
+ * system call, or NULL.
+ * @user_data: optional data which the guestrace event loop will pass to each call of @syscall_cb
+ *
+ * Sets the callback functions associated with @kernel_func. Each time
+ * processing a system call in the guest kernel calls @kernel_func,
+ * The loop will invoke @syscall_cb with the parameters associated with the
+ * call. When @kernel_func returns, the loop will invoke @sysret_cb.
+ *
+ * A NULL @sysret_cb places @kernel_func in call-only mode: the loop does not
+ * trap returns from @kernel_func, which halves the VM exits each call costs.
+ * In this case the loop discards the value @syscall_cb returns, so
+ * @syscall_cb must not return memory which requires freeing.
+ *
+ * Returns: %TRUE on success, %FALSE on failure; an invalid @kernel_func
+ * will cause the callback registration to fail.
+ **/
+gboolean gt_loop_set_cb(GtLoop *loop,
+                        const char *kernel_func,
+                        GtSyscallFunc syscall_cb,
+                        GtSysretFunc sysret_cb,
+                        void *user_data)
 {
-	GtLoop *loop = user_data;
+	gboolean fnval;
 
-	status_t status = vmi_events_listen(loop->vmi, 500);
-	if (status != VMI_SUCCESS) {
-		fprintf(stderr, "error waiting for events\n");
-		gt_running = FALSE;
+	if (NULL != loop->replay) {
+		return gt_replay_set_cb(loop, kernel_func, syscall_cb, sysret_cb, user_data, NULL);
 	}
 
-	if (!gt_running) {
-		g_main_loop_quit(loop->g_main_loop);
-	}
+	gt_loop_begin_update(loop);
 
-	return gt_running;
+	fnval = NULL != gt_register_cb(loop, kernel_func, 0, syscall_cb, sysret_cb, user_data);
+
+	gt_loop_commit_update(loop);
+
+	return fnval;
 }
 
 /**
- * gt_loop_run:
+ * gt_loop_set_cbs:
  * @loop: a #GtLoop.
+ * @syscalls: an array of #GtCallbackRegistry values, where each contains a
+ * function name and corresponding #GtSyscallFunc and #GtSysretFunc.
  *
- * Uses libvmi to complete the preparations necessary to trace a guest's system
- * calls. Runs @loop until gt_loop_quit() is called on @loop.
- */
-void gt_loop_run(GtLoop *loop)
+ * A convenience function which repeatedly invoke gt_loop_set_cb for each
+ * callback defined in @syscalls. The @syscalls array must be terminated with
+ * an #GtCallbackRegistry with each field set to NULL.
+ *
+ * Returns: an integer which represents the number of callbacks
+ * successfully set; an invalid function name in @syscalls will
+ * cause the corresponding callback registration to fail.
+ **/
+int
+gt_loop_set_cbs(GtLoop *loop, const GtCallbackRegistry callbacks[])
 {
-	status_t status;
-
-	status = early_boot_wait_for_os_load(loop);
-	if (VMI_SUCCESS != status) {
-                fprintf(stderr, "failed to wait on LSTAR.\n");
-                goto done;
-        }
-
-	status = early_boot_wait_for_first_process(loop);
-	if (VMI_SUCCESS != status) {
-                fprintf(stderr, "failed to wait for initialization\n");
-                goto done;
-        }
-
-	vmi_pause_vm(loop->vmi);
+	int count = 0, total;
+	addr_t *vas;
+
+	for (total = 0; callbacks[total].name; total++);
+
+	if (NULL != loop->replay) {
+		for (int i = 0; i < total; i++) {
+			count += gt_replay_set_cb(loop,
+			                          callbacks[i].name,
+			                          callbacks[i].syscall_cb,
+			                          callbacks[i].sysret_cb,
+			                          callbacks[i].user_data,
+			                          callbacks[i].filter);
+		}
 
-	status = vmi_slat_switch(loop->vmi, loop->shadow_view);
-	if (VMI_SUCCESS != status) {
-		fprintf(stderr, "failed to enable shadow view\n");
-		goto done;
+		return count;
 	}
 
-	if (!gt_set_up_generic_events(loop)) {
-		goto done;
-	}
+	gt_loop_begin_update(loop);
 
-	if (!gt_set_up_step_events(loop)) {
-		goto done;
+	/*
+	 * Resolve each symbol first, so that a single reservation can provide
+	 * every shadow page the callbacks require.
+	 */
+	vas = g_new0(addr_t, total);
+	for (int i = 0; i < total; i++) {
+		vas[i] = gt_attach_cache_ksym2v(loop, callbacks[i].name);
 	}
 
-	loop->return_addr = loop->os_functions->find_return_point_addr(loop);
-	if (0 == loop->return_addr) {
-		goto done;
-	}
+	gt_reserve_shadow_frames(loop, vas, total);
 
-	loop->trampoline_addr = gt_find_trampoline_addr(loop);
-	if (0 == loop->trampoline_addr) {
-		fprintf(stderr, "could not find addr. of existing int 3 inst.\n");
-		goto done;
-	}
+	for (int i = 0; i < total; i++) {
+		if (0 == vas[i]) {
+			continue;
+		}
 
-	vmi_resume_vm(loop->vmi);
+		gt_paddr_record *record = gt_register_cb(loop,
+		                                         callbacks[i].name,
+		                                         vas[i],
+		                                         callbacks[i].syscall_cb,
+		                                         callbacks[i].sysret_cb,
+		                                         callbacks[i].user_data);
+		if (NULL == record) {
+			continue;
+		}
 
-	g_idle_add(gt_loop_listen, loop);
-	g_main_loop_run(loop->g_main_loop);
+		if (NULL != callbacks[i].filter) {
+			gt_filter_unref(record->filter);
+			record->filter = gt_filter_ref(callbacks[i].filter);
+		}
 
-	vmi_pause_vm(loop->vmi);
+		count++;
+	}
 
-	/*
-	 * gt_running affects freeing of gt_ret_addr_mapping elements.
-	 * Must be false or return pointers on kernel stack will not be reset.
-	 * Thus we check no code has been altered in an ill way here, since
-	 * this requirement is not obvious.
-	 */
-	g_assert(!gt_running);
+	gt_release_spare_shadow_frames(loop);
 
-	g_hash_table_remove_all(loop->gt_page_translation);
-	g_hash_table_remove_all(loop->gt_ret_addr_mapping);
-	g_hash_table_remove_all(loop->gt_page_record_collection);
+	g_free(vas);
 
-	status = vmi_slat_switch(loop->vmi, 0);
-	if (VMI_SUCCESS != status) {
-		fprintf(stderr, "failed to reset EPT to point to default table\n");
-	}
+	gt_loop_commit_update(loop);
 
-	vmi_resume_vm(loop->vmi);
+	gt_attach_cache_save(loop);
 
-done:
-	return;
+	return count;
 }
 
-/**
- * gt_loop_quit:
- * @loop: a #GtLoop.
- *
- * Stops @loop from running. Any calls to gt_loop_run() for the loop will return.
- * This removes any modifications to the guest's memory and allows the guest
- * to run without instrumentation.
+/*
+ * Ensure guestrace instruments each of the kernel functions which create or
+ * destroy processes, so that it can invalidate its process caches. This
+ * leaves in place any callbacks the application already set on these
+ * functions.
  */
-void gt_loop_quit(GtLoop *loop)
+static void
+gt_set_up_process_lifecycle_hooks(GtLoop *loop)
 {
-	gt_running = FALSE;
-}
+	const char * const *create_funcs = loop->os_functions->process_create_funcs;
+	const char * const *start_funcs  = loop->os_functions->process_start_funcs;
+	const char * const *exit_funcs   = loop->os_functions->process_exit_funcs;
+
+	gt_loop_begin_update(loop);
+
+	/* Flush again on return; see gt_breakpoint_cb(). */
+	for (int i = 0; NULL != create_funcs[i]; i++) {
+		gt_register_cb(loop,
+		               create_funcs[i],
+		               0,
+		               gt_lifecycle_syscall_cb,
+		               gt_lifecycle_sysret_cb,
+		               NULL);
+	}
 
-/**
- * gt_loop_free:
- * @loop: a #GtLoop.
- *
- * Free @loop and its associated memory. If the loop is currently running, then
- * gt_loop_quit() must first terminate the loop and remove the guest
- * instrumentation.
- */
-void gt_loop_free(GtLoop *loop)
-{
-	if (NULL == loop) {
-		goto done;
+	/* Not system calls, so their returns cannot be trapped. */
+	for (int i = 0; NULL != start_funcs[i]; i++) {
+		gt_register_cb(loop,
+		               start_funcs[i],
+		               0,
+		               gt_lifecycle_syscall_cb,
+		               NULL,
+		               NULL);
 	}
 
-	vmi_pause_vm(loop->vmi);
+	/* Call only; the next process creation flushes any stale entries. */
+	for (int i = 0; NULL != exit_funcs[i]; i++) {
+		gt_register_cb(loop,
+		               exit_funcs[i],
+		               0,
+		               gt_lifecycle_syscall_cb,
+		               NULL,
+		               NULL);
+	}
 
-	g_hash_table_destroy(loop->gt_page_translation);
-	g_hash_table_destroy(loop->gt_ret_addr_mapping);
-	g_hash_table_destroy(loop->gt_page_record_collection);
+	gt_loop_commit_update(loop);
+}
 
-	vmi_slat_destroy(loop->vmi, loop->shadow_view);
-	vmi_slat_set_domain_state(loop->vmi, FALSE);
-	/* TODO: find out why this isn't decreasing main memory on next run of guestrace */
-	xc_domain_setmaxmem(loop->xch, loop->domid, loop->init_mem_size);
+/*
+ * Return the record describing the breakpoint on kernel_func, or NULL if
+ * there is none. Unlike gt_paddr_record_from_va(), this finds breakpoints
+ * added since the last rebuild of bp_index.
+ */
+static gt_paddr_record *
+gt_paddr_record_from_name(GtLoop *loop, const char *kernel_func)
+{
+	gt_paddr_record *paddr_record = NULL;
+	gt_page_record *page_record;
+	addr_t va, pa, shadow;
 
-	libxl_ctx_free(loop->ctx);
-	xc_interface_close(loop->xch);
+	va = gt_attach_cache_ksym2v(loop, kernel_func);
+	if (0 == va) {
+		goto done;
+	}
 
-	vmi_resume_vm(loop->vmi);
+	pa = vmi_translate_kv2p(loop->vmi, va);
+	if (0 == pa) {
+		goto done;
+	}
 
-	vmi_destroy(loop->vmi);
+	shadow = (addr_t) g_hash_table_lookup(loop->gt_page_translation,
+	                                      GSIZE_TO_POINTER(pa >> GT_PAGE_OFFSET_BITS));
+	if (0 == shadow) {
+		goto done;
+	}
 
-	g_main_loop_unref(loop->g_main_loop);
+	page_record = g_hash_table_lookup(loop->gt_page_record_collection,
+	                                  GSIZE_TO_POINTER(shadow));
+	if (NULL == page_record) {
+		goto done;
+	}
 
-	g_free(loop);
+	paddr_record = g_hash_table_lookup(page_record->children,
+	                                   GSIZE_TO_POINTER(pa % GT_PAGE_SIZE));
 
 done:
-	return;
+	return paddr_record;
 }
 
-/* Allocate a new page of memory in the guest's address space. */
-static addr_t
-gt_allocate_shadow_frame (GtLoop *loop)
+/**
+ * gt_loop_remove_cb:
+ * @loop: a #GtLoop.
+ * @kernel_func: the name of a function in the traced kernel which implements
+ * a system call.
+ *
+ * Removes the callbacks which gt_loop_set_cb() associated with @kernel_func,
+ * along with the breakpoint which invoked them. This is safe while @loop
+ * runs. The guestrace event loop will still invoke the #GtSysretFunc for
+ * calls to @kernel_func which had begun but not yet returned.
+ *
+ * Returns: %TRUE on success, %FALSE if no callback exists for @kernel_func.
+ **/
+gboolean
+gt_loop_remove_cb(GtLoop *loop, const char *kernel_func)
 {
-	int rc;
-	xen_pfn_t gfn = 0;
-	uint64_t proposed_mem_size = loop->curr_mem_size + GT_PAGE_SIZE;
+	gboolean ok = FALSE;
+	gt_paddr_record *record;
 
-	rc = xc_domain_setmaxmem(loop->xch, loop->domid, proposed_mem_size);
-	if (rc < 0) {
-		fprintf(stderr,
-		       "failed to increase memory size on guest to %lx\n",
-		        proposed_mem_size);
-		goto done;
+	if (NULL != loop->replay) {
+		return gt_replay_remove_cb(loop, kernel_func);
 	}
 
-	loop->curr_mem_size = proposed_mem_size;
+	gt_loop_begin_update(loop);
 
-	rc = xc_domain_increase_reservation_exact(loop->xch, loop->domid,
-	                                              1, 0, 0, &gfn);
-	if (rc < 0) {
-		fprintf(stderr, "failed to increase reservation on guest");
+	record = gt_paddr_record_from_name(loop, kernel_func);
+	if (NULL == record) {
 		goto done;
 	}
 
-	rc = xc_domain_populate_physmap_exact(loop->xch, loop->domid, 1, 0,
-	                                          0, &gfn);
-	if (rc < 0) {
-		fprintf(stderr, "failed to populate GFN at 0x%lx\n", gfn);
-		gfn = 0;
-		goto done;
+	if (record->flushes_process_caches) {
+		/* Guestrace itself relies on this breakpoint. */
+		record->syscall_cb = gt_lifecycle_syscall_cb;
+		record->sysret_cb  = gt_is_process_create_func(loop, kernel_func)
+		                   ? gt_lifecycle_sysret_cb
+		                   : NULL;
+		record->data       = NULL;
+		record->enabled    = TRUE;
+	} else {
+		gt_unset_mem_trap(loop, record);
 	}
 
+	ok = TRUE;
+
 done:
-	return gfn;
+	gt_loop_commit_update(loop);
+
+	return ok;
 }
 
-/* Remove the breakpoint associated with paddr_record.  */
-static status_t
-gt_remove_breakpoint(gt_paddr_record *paddr_record) {
-	uint8_t curr_inst;
-	status_t status     = VMI_FAILURE;
-	addr_t frame        = paddr_record->parent->frame;
-	addr_t shadow_frame = paddr_record->parent->shadow_frame;
-	addr_t offset       = paddr_record->offset;
+/**
+ * gt_loop_set_cb_enabled:
+ * @loop: a #GtLoop.
+ * @kernel_func: the name of a function in the traced kernel which implements
+ * a system call.
+ * @enabled: whether guestrace should invoke the callbacks on @kernel_func.
+ *
+ * Disables or re-enables the callbacks which gt_loop_set_cb() associated
+ * with @kernel_func. This is safe while @loop runs. Disabling a callback
+ * restores the original instruction in the shadow page, so calls to
+ * @kernel_func no longer cause the guest to exit to guestrace.
+ *
+ * Returns: %TRUE on success, %FALSE if no callback exists for @kernel_func.
+ **/
+gboolean
+gt_loop_set_cb_enabled(GtLoop *loop, const char *kernel_func, gboolean enabled)
+{
+	gboolean ok = FALSE;
+	status_t status = VMI_SUCCESS;
+	gt_paddr_record *record;
+
+	if (NULL != loop->replay) {
+		return gt_replay_set_cb_enabled(loop, kernel_func, enabled);
+	}
+
+	gt_loop_begin_update(loop);
 
-	status = vmi_read_8_pa(paddr_record->parent->loop->vmi,
-	                      (frame << GT_PAGE_OFFSET_BITS) + offset,
-	                      &curr_inst);
-	if (VMI_SUCCESS != status) {
+	record = gt_paddr_record_from_name(loop, kernel_func);
+	if (NULL == record) {
 		goto done;
 	}
 
-	status = vmi_write_8_pa(paddr_record->parent->loop->vmi,
-	                       (shadow_frame << GT_PAGE_OFFSET_BITS) + offset,
-	                       &curr_inst);
+	if (enabled == record->enabled) {
+		ok = TRUE;
+		goto done;
+	}
 
-done:
-	return status;
-}
+	/*
+	 * Guestrace itself relies on the breakpoints on process-lifecycle
+	 * functions, so instead gt_breakpoint_cb() skips the callbacks.
+	 */
+	if (!record->flushes_process_caches) {
+		status = enabled ? gt_set_breakpoint(record)
+		                 : gt_remove_breakpoint(record);
+	}
 
-static void
-gt_destroy_paddr_record (gpointer data) {
-	gt_paddr_record *paddr_record = data;
+	if (VMI_SUCCESS != status) {
+		fprintf(stderr, "failed to update breakpoint on %s\n", kernel_func);
+		goto done;
+	}
 
-	gt_remove_breakpoint(paddr_record);
+	record->enabled           = enabled;
+	record->sampling_disarmed = FALSE;
+	ok = TRUE;
 
-	g_free(paddr_record);
+done:
+	gt_loop_commit_update(loop);
+
+	return ok;
 }
 
 /*
- * Ensure there exists a memory trap on the shadow page containing virtual
- * address va, and create a page record if it does not yet exist. Add a
- * physical-address record corresponding to va to the page record's collection
- * of children.
+ * Arm or disarm record's breakpoint on behalf of its sampler. Writing the
+ * single byte of the breakpoint is atomic, so this needs no pause of the
+ * guest. The process-lifecycle breakpoints stay put; see above.
  */
-static gt_paddr_record *
-gt_setup_mem_trap (GtLoop *loop,
-                   addr_t va,
-                   GtSyscallFunc syscall_cb,
-                   GtSysretFunc sysret_cb,
-                   void *user_data)
+static void
+gt_sampling_arm(gt_paddr_record *record, gboolean arm)
 {
-	size_t ret;
 	status_t status;
-	gt_page_record  *page_record  = NULL;
-	gt_paddr_record *paddr_record = NULL;
 
-	addr_t pa = vmi_translate_kv2p(loop->vmi, va);
-	if (0 == pa) {
-		fprintf(stderr, "virtual addr. translation failed: %lx\n", va);
+	if (arm != record->sampling_disarmed
+	 || !record->enabled
+	 || record->flushes_process_caches
+	 || NULL == record->parent) {
 		goto done;
 	}
 
-	addr_t frame = pa >> GT_PAGE_OFFSET_BITS;
-	addr_t shadow = (addr_t) g_hash_table_lookup(loop->gt_page_translation,
-		                                     GSIZE_TO_POINTER(frame));
-	addr_t shadow_offset = pa % GT_PAGE_SIZE;
-
-	if (0 == shadow) {
-		/* Record does not exist; allocate new page and create record. */
-		shadow = gt_allocate_shadow_frame(loop);
-		if (0 == shadow) {
-			fprintf(stderr, "failed to allocate shadow page\n");
-			goto done;
-		}
+	status = arm ? gt_set_breakpoint(record) : gt_remove_breakpoint(record);
+	if (VMI_SUCCESS != status) {
+		goto done;
+	}
 
-		g_hash_table_insert(loop->gt_page_translation,
-		                    GSIZE_TO_POINTER(frame),
-		                    GSIZE_TO_POINTER(shadow));
+	record->sampling_disarmed = !arm;
 
-		/* Activate in shadow view. */
-		status = vmi_slat_change_gfn(loop->vmi,
-		                             loop->shadow_view,
-		                             frame,
-		                             shadow);
-		if (VMI_SUCCESS != status) {
-			fprintf(stderr, "failed to update shadow view\n");
-			goto done;
-		}
+	if (!arm) {
+		record->disarms++;
 	}
 
-	page_record = g_hash_table_lookup(loop->gt_page_record_collection,
-	                                  GSIZE_TO_POINTER(shadow));
-	if (NULL == page_record) {
-		/* No record for this page yet; create one. */
-
-		/* Copy page to shadow. */
-		uint8_t buff[GT_PAGE_SIZE] = {0};
-		ret = vmi_read_pa(loop->vmi,
-		                  frame << GT_PAGE_OFFSET_BITS,
-		                  buff,
-		                  GT_PAGE_SIZE);
-		if (GT_PAGE_SIZE != ret) {
-			fprintf(stderr, "failed to read in syscall page\n");
-			goto done;
-		}
+done:
+	return;
+}
 
-		ret = vmi_write_pa(loop->vmi,
-		                   shadow << GT_PAGE_OFFSET_BITS,
-		                   buff,
-		                   GT_PAGE_SIZE);
-		if (GT_PAGE_SIZE != ret) {
-			fprintf(stderr, "failed to write to shadow page\n");
-			goto done;
-		}
+/*
+ * Arm and disarm the breakpoints of loop's samplers as their duty cycles and
+ * budgets require. Runs on the loop's thread every GT_SAMPLING_TICK_MS, until
+ * no callback has a sampler.
+ */
+static gboolean
+gt_sampling_tick(gpointer data)
+{
+	GtLoop *loop = data;
+	gboolean any = FALSE;
+	guint64 now = gt_stats_now();
 
-		/* Initialize record of this page. */
-		page_record              = g_new0(gt_page_record, 1);
-		page_record->shadow_frame = shadow;
-		page_record->frame       = frame;
-		page_record->loop        = loop;
-		page_record->children    = g_hash_table_new_full(NULL,
-		                                       NULL,
-		                                       NULL,
-		                                       gt_destroy_paddr_record);
+	g_rec_mutex_lock(&loop->lock);
 
-		g_hash_table_insert(loop->gt_page_record_collection,
-		                    GSIZE_TO_POINTER(shadow),
-		                    page_record);
+	for (guint64 i = 0; NULL != loop->bp_index && i < (1ull << loop->bp_index_bits); i++) {
+		gt_paddr_record *record = loop->bp_index[i].record;
 
-		/* Establish callback on a R/W of this page. */
-		vmi_set_mem_event(loop->vmi, frame, VMI_MEMACCESS_RW,
-		                  loop->shadow_view);
-	} else {
-		/* We already have a page record for this page in collection. */
-		paddr_record = g_hash_table_lookup(page_record->children,
-		                                GSIZE_TO_POINTER(shadow_offset));
-		if (NULL != paddr_record) {
-			/* We have a paddr record too; done (no error). */
-			goto done;
+		if (0 == loop->bp_index[i].va || NULL == record->sampler) {
+			continue;
 		}
+
+		gt_sampling_arm(record, gt_sampler_should_arm(record->sampler, now));
+		any = TRUE;
 	}
 
-	/* Create physical-address record and add to page record. */
-	paddr_record             = g_new0(gt_paddr_record, 1);
-	paddr_record->offset     = shadow_offset;
-	paddr_record->parent     = page_record;
-	paddr_record->syscall_cb = syscall_cb;
-	paddr_record->sysret_cb  = sysret_cb;
-	paddr_record->data       = user_data;
+	if (!any) {
+		g_source_unref(loop->sampling_source);
+		loop->sampling_source = NULL;
+	}
 
-	/* Write interrupt to our shadow page at the correct location. */
-	status = vmi_write_8_pa(loop->vmi,
-	                       (shadow << GT_PAGE_OFFSET_BITS) + shadow_offset,
-	                       &GT_BREAKPOINT_INST);
-	if (VMI_SUCCESS != status) {
-		fprintf(stderr, "failed to write interrupt to shadow page\n");
+	g_rec_mutex_unlock(&loop->lock);
+
+	return any ? G_SOURCE_CONTINUE : G_SOURCE_REMOVE;
+}
+
+/* Start gt_sampling_tick() if loop is running and it has not yet started. */
+static void
+gt_sampling_start(GtLoop *loop)
+{
+	if (NULL != loop->sampling_source || NULL == loop->sampling_context) {
 		goto done;
 	}
 
-	g_hash_table_insert(page_record->children,
-	                    GSIZE_TO_POINTER(shadow_offset),
-	                    paddr_record);
+	loop->sampling_source = g_timeout_source_new(GT_SAMPLING_TICK_MS);
+	g_source_set_callback(loop->sampling_source, gt_sampling_tick, loop, NULL);
+	g_source_attach(loop->sampling_source, loop->sampling_context);
 
 done:
-	/* TODO: Should undo loop (e.g., remove from hash tables) on error */
-	return paddr_record;
+	return;
+}
+
+static void
+gt_sampling_stop(GtLoop *loop)
+{
+	if (NULL != loop->sampling_source) {
+		g_source_destroy(loop->sampling_source);
+		g_source_unref(loop->sampling_source);
+		loop->sampling_source = NULL;
+	}
+}
+
+/* Replace or remove the sampler of record. */
+static void
+gt_sampling_set(gt_paddr_record *record, const GtSampling *sampling)
+{
+	/* Without a sampler, nothing would re-arm the breakpoint. */
+	gt_sampling_arm(record, TRUE);
+	gt_sampler_free(record->sampler);
+
+	record->sampler = NULL == sampling ? NULL : gt_sampler_new(sampling, gt_stats_now());
 }
 
 /**
- * gt_loop_set_cb:
+ * gt_loop_set_sampling:
  * @loop: a #GtLoop.
- * @kernel_func: the name of a function in the traced kernel which implements
- * a system call.
- * @syscall_cb: a #GtSyscallFunc which will handle the named system call.
- * @sysret_cb: a #GtSysretFunc which will handle returns from the named
- * system call.
- * @user_data: optional data which the guestrace event loop will pass to each call of @syscall_cb
+ * @kernel_func: the name of a function which has callbacks, or NULL for
+ * every function which has callbacks.
+ * @sampling: a #GtSampling, or NULL to pass every call to the callbacks.
  *
- * Sets the callback functions associated with @kernel_func. Each time
- * processing a system call in the guest kernel calls @kernel_func,
- * The loop will invoke @syscall_cb with the parameters associated with the
- * call. When @kernel_func returns, the loop will invoke @sysret_cb.
+ * Passes only a sample of the calls to @kernel_func to its callbacks, as
+ * @sampling describes. Calls which the sampler skips cost neither a
+ * callback nor a trap of the return, and #GtSyscallStats counts them as
+ * skipped. When @sampling's budget runs out, or its duty cycle turns off,
+ * guestrace restores the original instruction in the shadow page, so that
+ * calls cost no exit at all until it re-arms the breakpoint; it cannot count
+ * those calls. This is safe while @loop runs. Not supported by loops which
+ * replay a trace.
  *
- * Returns: %TRUE on success, %FALSE on failure; an invalid @kernel_func
- * will cause the callback registration to fail.
+ * Returns: %TRUE on success, %FALSE if no callback exists for @kernel_func.
  **/
-gboolean gt_loop_set_cb(GtLoop *loop,
-                        const char *kernel_func,
-                        GtSyscallFunc syscall_cb,
-                        GtSysretFunc sysret_cb,
-                        void *user_data)
+gboolean
+gt_loop_set_sampling(GtLoop *loop, const char *kernel_func, const GtSampling *sampling)
 {
-	gboolean fnval = FALSE;
+	gboolean ok = FALSE;
+	gt_paddr_record *record;
 
-	addr_t sysaddr;
-	gt_paddr_record *syscall_trap;
+	if (NULL != loop->replay) {
+		goto done;
+	}
 
-	vmi_pause_vm(loop->vmi);
+	gt_loop_begin_update(loop);
 
-	sysaddr = vmi_translate_ksym2v(loop->vmi, kernel_func);
-	if (0 == sysaddr) {
-		goto done;
+	if (NULL != kernel_func) {
+		record = gt_paddr_record_from_name(loop, kernel_func);
+		if (NULL != record) {
+			gt_sampling_set(record, sampling);
+			ok = TRUE;
+		}
+	} else {
+		for (guint64 i = 0; NULL != loop->bp_index && i < (1ull << loop->bp_index_bits); i++) {
+			if (0 != loop->bp_index[i].va) {
+				gt_sampling_set(loop->bp_index[i].record, sampling);
+				ok = TRUE;
+			}
+		}
 	}
 
-	syscall_trap = gt_setup_mem_trap(loop, sysaddr, syscall_cb, sysret_cb, user_data);
-	if (NULL == syscall_trap) {
-		goto done;
+	if (NULL != sampling) {
+		gt_sampling_start(loop);
 	}
 
-	fnval = TRUE;
+	gt_loop_commit_update(loop);
 
 done:
-	vmi_resume_vm(loop->vmi);
+	return ok;
+}
 
-	return fnval;
+/**
+ * gt_loop_set_filter:
+ * @loop: a #GtLoop.
+ * @filter: a #GtFilter, or NULL.
+ *
+ * Restricts every callback on @loop to the system calls which @filter
+ * accepts. The guestrace event loop neither invokes the #GtSyscallFunc nor
+ * the #GtSysretFunc for a rejected call, and it does not trap the call's
+ * return. @loop takes a reference to @filter. A NULL @filter removes any
+ * existing filter. This is safe while @loop runs.
+ */
+void
+gt_loop_set_filter(GtLoop *loop, GtFilter *filter)
+{
+	/* The event callbacks read loop->filter under the lock. */
+	g_rec_mutex_lock(&loop->lock);
+
+	gt_filter_unref(loop->filter);
+	loop->filter = NULL == filter ? NULL : gt_filter_ref(filter);
+
+	g_rec_mutex_unlock(&loop->lock);
 }
 
 /**
- * gt_loop_set_cbs:
+ * gt_loop_set_memory_cb:
  * @loop: a #GtLoop.
- * @syscalls: an array of #GtCallbackRegistry values, where each contains a
- * function name and corresponding #GtSyscallFunc and #GtSysretFunc.
+ * @memory_cb: a #GtMemoryFunc, or NULL.
+ * @user_data: data to pass to @memory_cb.
  *
- * A convenience function which repeatedly invoke gt_loop_set_cb for each
- * callback defined in @syscalls. The @syscalls array must be terminated with
- * an #GtCallbackRegistry with each field set to NULL.
+ * Has @loop pass each range of guest memory which its callbacks read to
+ * @memory_cb, which might record the memory in a trace for
+ * gt_replay_loop_new(). Set @memory_cb before running @loop. A NULL
+ * @memory_cb stops the reports.
+ */
+void
+gt_loop_set_memory_cb(GtLoop *loop, GtMemoryFunc memory_cb, void *user_data)
+{
+	loop->memory_cb   = memory_cb;
+	loop->memory_data = user_data;
+}
+
+/**
+ * gt_loop_set_execute_only:
+ * @loop: a #GtLoop.
+ * @enabled: whether to use an execute-only view.
  *
- * Returns: an integer which represents the number of callbacks
- * successfully set; an invalid function name in @syscalls will
- * cause the corresponding callback registration to fail.
+ * Services reads and writes of the pages which hold breakpoints, such as
+ * those of Windows kernel patch protection, without single-stepping. The
+ * first access moves the VCPU to a second view, which maps each page to its
+ * original contents and traps only execution, so that later accesses cause
+ * no exit until the VCPU executes one of the pages again. Where the hardware
+ * cannot trap execution alone, @loop single-steps each access as it does by
+ * default. Set @enabled before running @loop; see #GtPageStats for the
+ * counters which measure the exits avoided.
+ */
+void
+gt_loop_set_execute_only(GtLoop *loop, gboolean enabled)
+{
+	loop->execute_only = enabled;
+}
+
+/**
+ * gt_loop_set_lazy_detach:
+ * @loop: a #GtLoop.
+ * @timeout: how long to drain, in milliseconds, or 0.
+ *
+ * Bounds the time for which the guest remains paused as @loop detaches.
+ * By default, gt_loop_run() pauses the guest once gt_loop_quit() takes
+ * effect and restores the stack of each system call in flight. With a
+ * nonzero @timeout, it first removes only the breakpoints on calls and goes
+ * on servicing returns, calling their #GtSysretFunc, for up to @timeout
+ * milliseconds, so that the pause need restore only the stacks of calls
+ * which are still blocked. Replays ignore @timeout.
+ */
+void
+gt_loop_set_lazy_detach(GtLoop *loop, guint timeout)
+{
+	loop->lazy_detach_ms = timeout;
+}
+
+/**
+ * gt_loop_set_attach_cache:
+ * @loop: a #GtLoop.
+ * @dir: a directory, or NULL.
+ *
+ * Has @loop remember, in a file under @dir, what it discovers about the
+ * guest kernel while attaching: the return point in the system-call handler,
+ * the trampolines near LSTAR and the address of each kernel symbol. Loops
+ * which later attach to a guest running the same kernel build read the file
+ * instead of repeating the discovery. Set @dir before setting callbacks or
+ * running @loop. A NULL @dir disables the cache.
+ */
+void
+gt_loop_set_attach_cache(GtLoop *loop, const char *dir)
+{
+	gt_attach_cache_free(loop);
+	g_free(loop->attach_cache_dir);
+
+	loop->attach_cache_dir = g_strdup(dir);
+}
+
+/**
+ * gt_loop_set_cb_filter:
+ * @loop: a #GtLoop.
+ * @kernel_func: the name of a function in the traced kernel which implements
+ * a system call.
+ * @filter: a #GtFilter, or NULL.
+ *
+ * Like gt_loop_set_filter(), but @filter restricts only the callbacks on
+ * @kernel_func. A call must satisfy both the filter on @loop and the filter
+ * on @kernel_func. @loop takes a reference to @filter.
+ *
+ * Returns: %TRUE on success, %FALSE if no callback exists for @kernel_func.
  **/
-int
-gt_loop_set_cbs(GtLoop *loop, const GtCallbackRegistry callbacks[])
+gboolean
+gt_loop_set_cb_filter(GtLoop *loop, const char *kernel_func, GtFilter *filter)
 {
-	int count = 0;
+	gboolean ok = FALSE;
+	gt_paddr_record *record;
 
-	for (int i = 0; callbacks[i].name; i++) {
-		gboolean ok = gt_loop_set_cb(loop,
-		                             callbacks[i].name,
-		                             callbacks[i].syscall_cb,
-		                             callbacks[i].sysret_cb,
-		                             callbacks[i].user_data);
-		if (ok) {
-			count++;
-		}
+	if (NULL != loop->replay) {
+		return gt_replay_set_cb_filter(loop, kernel_func, filter);
 	}
 
-	return count;
+	gt_loop_begin_update(loop);
+
+	record = gt_paddr_record_from_name(loop, kernel_func);
+	if (NULL == record) {
+		goto done;
+	}
+
+	gt_filter_unref(record->filter);
+	record->filter = NULL == filter ? NULL : gt_filter_ref(filter);
+
+	ok = TRUE;
+
+done:
+	gt_loop_commit_update(loop);
+
+	return ok;
 }
 
 /**
@@ -1308,6 +3850,27 @@ gt_loop_add_watch(GIOChannel *channel,
 	return g_io_add_watch(channel, condition, func, user_data);
 }
 
+/*
+ * Like gt_loop_add_watch(), but watches fd using context, and returns a
+ * reference to the new source.
+ */
+static GSource *
+gt_add_watch(GMainContext *context,
+             int fd,
+             GIOCondition condition,
+             GIOFunc func,
+             gpointer user_data)
+{
+	GIOChannel *channel = g_io_channel_unix_new(fd);
+	GSource *source = g_io_create_watch(channel, condition);
+
+	g_source_set_callback(source, (GSourceFunc) func, user_data, NULL);
+	g_source_attach(source, context);
+	g_io_channel_unref(channel);
+
+	return source;
+}
+
 /*
  * Disassemble a page of memory beginning at <start> until
  * finding the correct mnemonic and op_str, returning the next address.
@@ -5,10 +5,42 @@
 struct os_functions {
 	/* <private> */
         addr_t (*find_return_point_addr) (GtLoop *loop);
+        char  *(*get_process_name) (GtLoop *loop, gt_pid_t pid);
+
+	/* Decode a system-call argument according to the calling convention. */
+	gboolean (*get_arg) (GtArgs *args, guint index, gt_reg_t *value);
+
+	/*
+	 * NULL-terminated lists of kernel functions which create or destroy
+	 * processes; servicing any of these invalidates cached process data.
+	 * Guestrace traps the returns of only the system calls which create
+	 * processes, since a new address space exists only once they return.
+	 * The start functions, which need not be system calls, run once a new
+	 * process has its address space but before it runs, so that a DTB
+	 * freed by a process which died without a traced exit cannot remain
+	 * cached; the exit functions include those by which a signal kills.
+	 * The attach cache records kernel addresses relative to the first
+	 * creation function, so every kernel must have it.
+	 */
+	const char * const *process_create_funcs;
+	const char * const *process_start_funcs;
+	const char * const *process_exit_funcs;
 };
 
-/* Maximum number of VCPUs VisorFlow will support. */
-#define _GT_MAX_VCPUS 16
+/* Maximum number of system-call arguments which GtArgs decodes. */
+#define GT_ARGS_MAX 18
+
+/* Number of guest pages which GtArgs caches during an event. */
+#define GT_ARGS_PAGES 8
+
+/* Size of a cache line; see gt_vcpu. */
+#define GT_CACHE_LINE_SIZE 64
+
+/* Number of VCPUs which a libvmi single-step event mask can name. */
+#define GT_STEP_MASK_VCPUS 32
+
+/* Milliseconds between re-evaluations of samplers; see gt_loop_set_sampling(). */
+#define GT_SAMPLING_TICK_MS 10
 
 /* Number of bits available for page offset. */
 #define GT_PAGE_OFFSET_BITS 12
@@ -16,6 +48,9 @@ struct os_functions {
 /* Default page size on our domain. */
 #define GT_PAGE_SIZE (1 << GT_PAGE_OFFSET_BITS)
 
+/* CR3 bits which select a PCID rather than a page directory. */
+#define GT_CR3_PCID_MASK 0xfffull
+
 /* Intel breakpoint interrupt (INT 3) instruction. */
 extern uint8_t GT_BREAKPOINT_INST;
 
@@ -24,4 +59,12 @@ addr_t _gt_find_addr_after_instruction(GtLoop *loop,
                                       char *mnemonic,
                                       char *ops);
 
+gboolean _gt_loop_wait(GtLoop *loop, int timeout, gboolean events);
+
+GtLoop *_gt_loop_alloc(const char *guest_name);
+
+GtVcpuStats *_gt_loop_get_vcpu_stats(GtLoop *loop, guint vcpu_id);
+
+guint _gt_loop_cb_id(GtLoop *loop, const char *kernel_func);
+
 #endif